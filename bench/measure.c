@@ -0,0 +1,101 @@
+// Copyright 2023, Brian Swetland <swetland@frotz.net>
+// Licensed under the Apache License, Version 2.0.
+
+// measure: run a command repeatedly and report its wall time and
+// peak resident set size
+//
+// usage: measure [-n runs] command [ args... ]
+//
+// The command's stdout goes to /dev/null.  A single line is written:
+//   runs min-ns p50-ns p90-ns p99-ns max-ns maxrss-kb
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+
+static uint64_t now_ns(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t) ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+}
+
+static int cmp_u64(const void* a, const void* b) {
+	uint64_t x = *((const uint64_t*) a);
+	uint64_t y = *((const uint64_t*) b);
+	return (x > y) - (x < y);
+}
+
+// nearest-rank percentile of sorted samples
+static uint64_t pct(uint64_t* t, unsigned n, unsigned p) {
+	return t[(p * (n - 1) + 50) / 100];
+}
+
+// run argv once, returning elapsed ns and updating *maxrss
+static uint64_t run(char** argv, long* maxrss) {
+	uint64_t t0 = now_ns();
+	pid_t pid = fork();
+	if (pid < 0) {
+		perror("measure: fork");
+		exit(1);
+	}
+	if (pid == 0) {
+		int fd = open("/dev/null", O_WRONLY);
+		if (fd >= 0) {
+			dup2(fd, 1);
+			close(fd);
+		}
+		execvp(argv[0], argv);
+		fprintf(stderr, "measure: cannot exec '%s'\n", argv[0]);
+		_exit(127);
+	}
+	int status;
+	struct rusage ru;
+	if (wait4(pid, &status, 0, &ru) < 0) {
+		perror("measure: wait4");
+		exit(1);
+	}
+	uint64_t t1 = now_ns();
+	if (!WIFEXITED(status) || (WEXITSTATUS(status) != 0)) {
+		fprintf(stderr, "measure: '%s' failed (status 0x%x)\n", argv[0], status);
+		exit(1);
+	}
+	if (ru.ru_maxrss > *maxrss) {
+		*maxrss = ru.ru_maxrss;
+	}
+	return t1 - t0;
+}
+
+int main(int argc, char** argv) {
+	unsigned runs = 1;
+	argc--;
+	argv++;
+	if ((argc > 1) && !strcmp(argv[0], "-n")) {
+		runs = atoi(argv[1]);
+		argc -= 2;
+		argv += 2;
+	}
+	if ((argc < 1) || (runs < 1)) {
+		fprintf(stderr, "usage: measure [-n runs] command [ args... ]\n");
+		return 1;
+	}
+
+	uint64_t* t = malloc(sizeof(uint64_t) * runs);
+	long maxrss = 0;
+	for (unsigned n = 0; n < runs; n++) {
+		t[n] = run(argv, &maxrss);
+	}
+	qsort(t, runs, sizeof(uint64_t), cmp_u64);
+	printf("%u %llu %llu %llu %llu %llu %ld\n", runs,
+		(unsigned long long) t[0],
+		(unsigned long long) pct(t, runs, 50),
+		(unsigned long long) pct(t, runs, 90),
+		(unsigned long long) pct(t, runs, 99),
+		(unsigned long long) t[runs - 1], maxrss);
+	return 0;
+}
@@ -8,14 +8,22 @@
 #include <stdbool.h>
 #include <string.h>
 
+#include <time.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 // builtin types
 #define nil 0
 typedef uint32_t u32;
 typedef int32_t i32;
 typedef uint8_t u8;
+typedef uint64_t u64;
 
 typedef uint32_t token_t;
 
@@ -25,21 +33,36 @@ void error(const char *fmt, ...);
 // structures
 
 typedef struct String String;
+typedef struct Output Output;
 typedef struct Symbol Symbol;
 typedef struct Scope Scope;
 typedef struct Type Type;
 
+struct Output {
+	char *data;
+	size_t len;
+	size_t max;
+};
+
 struct String {
-	String *next;
+	Symbol *sym;     // innermost live binding of this name
+	Type *type;      // type defined with this name
+	u32 token;       // token kind if a keyword, otherwise 0
+	u32 hash;
 	u32 len;
 	char text[0];
 };
 
 struct Symbol {
 	Symbol *next;
+	Symbol *shadow;  // binding of the same name this one hides
 	String *name;
 	Type *type;
 	u32 kind;
+	u32 flags;
+	u32 index;       // for: struct fields, ordinal
+	u32 offset;      // for: struct fields, byte offset
+	u32 noescape;    // for: analyzed fns, params that do not escape
 };
 enum {
 	SYMBOL_VAR,
@@ -48,6 +71,10 @@ enum {
 	SYMBOL_DEF, // enum
 	SYMBOL_FN,
 };
+enum {
+	SYM_ESCAPES = 1,  // value may outlive its function
+	SYM_ANALYZED = 2, // fn escape summary is known
+};
 
 struct Scope {
 	Scope *parent;
@@ -64,12 +91,17 @@ enum {
 };
 
 struct Type {
-	Type *next;
+	Type *next;      // all named types, or siblings in of->derived
 	String *name;
 	Type *of;        // for: slice, array, ptr
+	Type *derived;   // composite types whose 'of' is this type
 	Symbol *fields;  // for: struct
+	Symbol **fieldtab; // for: large structs, fields by name
+	u32 fieldmask;
 	u32 kind;
 	u32 count;       // for: arrays
+	u32 size;        // for: struct (align 0 if layout unknown)
+	u32 align;
 };
 enum {
 	TYPE_VOID,
@@ -77,7 +109,7 @@ enum {
 	TYPE_U8,
 	TYPE_U32,
 //	TYPE_NIL,
-//	TYPE_POINTER,
+	TYPE_POINTER,    // for: array elements held by reference
 	TYPE_ARRAY,
 	TYPE_SLICE,
 	TYPE_STR,
@@ -87,40 +119,122 @@ enum {
 	TYPE_UNDEFINED,
 };
 
+typedef struct Alloc Alloc;
 typedef struct Ctx Ctx;
 
+// new(type) initializing a local var, stack allocated if it does not escape
+struct Alloc {
+	Symbol *var;
+	String *type;
+	u32 id;
+};
+
+// ------------------------------------------------------------------
+// bump allocation arenas
+
+typedef struct Chunk Chunk;
+typedef struct Arena Arena;
+
+struct Chunk {
+	Chunk *next;
+	u8 *limit;
+	u8 data[0];
+};
+
+struct Arena {
+	Chunk *first;
+	Chunk *cur;
+	u8 *ptr;         // next free byte in cur
+};
+
+#define CHUNK_SIZE (64 * 1024)
+
+// arena allocations are counted by kind, for -T
+enum {
+	ALLOC_STRING,
+	ALLOC_SYMBOL,
+	ALLOC_TYPE,
+	ALLOC_SCOPE,
+	ALLOC_FIELDTAB,
+	ALLOC_KINDS,
+};
+
+// ------------------------------------------------------------------
+// statistics, reported by -T
+
+typedef struct Stats Stats;
+
+struct Stats {
+	u64 t_read;            // ns spent per phase
+	u64 t_lex;
+	u64 t_parse;           // parse, symbol resolution, and emit are one pass
+	u64 t_write;
+	u32 files;
+	u32 lines;
+	u64 bytes;
+	u64 tokens;
+	u64 intern_lookups;    // string_make() calls
+	u64 intern_hits;       // ... that found an existing string
+	u64 intern_probes;     // slots examined
+	u64 symbol_lookups;    // symbol_find() calls, one probe each
+	u64 field_lookups;
+	u64 field_probes;      // fields or fieldtab slots examined
+	u64 alloc_count[ALLOC_KINDS];
+	u64 alloc_bytes[ALLOC_KINDS];
+};
+
 // ------------------------------------------------------------------
 // compiler global context
 
 struct Ctx {
 	const char* filename;  // filename of active source
 	const char* outname;   // base name for output files
-	int fd;
 
-	FILE *fp_decl;         // output files
-	FILE *fp_type;
-	FILE *fp_impl;
+	Output out_decl;       // output files, written out at exit
+	Output out_type;
+	Output out_impl;
+	u32 indent;            // of the current impl line
+	bool impl_bol;         // impl is at the beginning of a line
 
-	int nl_decl;           // flag to update #line
-	int nl_type;
-	int nl_impl;
+	bool linemap;          // map impl lines to source with #line
+	u32 srcline;           // line of the statement being emitted
+	u32 impl_line;         // source line the next impl line maps to
+	const char *impl_file; // ... and its file
 
-	u8 iobuffer[1024];     // scanner file io buffer
-	u32 ionext;
-	u32 iolast;
+	const u8 *src;         // source file, always NUL terminated
+	size_t srcsize;        // bytes mapped or allocated for it
+	bool srcmapped;
 
 	u32 linenumber;        // line number of most recent line
-	u32 lineoffset;        // position of start of most recent line
 	u32 byteoffset;        // position of the most recent character
 	u32 flags;
 	u32 cc;                // scanner: next character
 
+	// the source is lexed up front into an array of tokens,
+	// stored by field, which next() steps through
+	u8 *tokkind;
+	u32 *tokval;           // tNUM: value, tIDN, tSTR: index in tokstr
+	                       // ( [ {: index of the matching ) ] }, or 0
+	u32 *tokpos;           // position in src
+	u32 tokcount;
+	u32 tokmax;
+	u32 tokidx;            // of the token after ctx.tok
+	String **tokstr;       // identifiers and string constants
+	u32 tokstr_count;
+	u32 tokstr_max;
+	u32 *lines;            // positions in src where each line starts
+	u32 line_count;
+	u32 line_max;
+
 	token_t tok;           // most recent token
+	u32 tokoff;            // its position in src
 	u32 num;               // used for tNUM
-	char tmp[256];         // used for tIDN, tSTR;
-	String *ident;         // used for tIDN
+	char tmp[256];         // used by the scanner for tSTR
+	String *ident;         // used for tIDN, tSTR
 
-	String *stringlist;    // all strings
+	String **strtab;       // intern table (open addressing)
+	u32 strtab_size;       // number of slots (power of two)
+	u32 strtab_count;      // number of slots in use
 	Type *typelist;        // all types
 
 	Scope *scope;          // scope stack
@@ -128,23 +242,19 @@ struct Ctx {
 
 	Scope global;
 
-	String *idn_if;        // identifier strings
-	String *idn_fn;
-	String *idn_for;
-	String *idn_var;
-	String *idn_nil;
-	String *idn_new;
-	String *idn_case;
-	String *idn_else;
-	String *idn_enum;
-	String *idn_true;
-	String *idn_break;
-	String *idn_while;
-	String *idn_false;
-	String *idn_switch;
-	String *idn_struct;
-	String *idn_return;
-	String *idn_continue;
+	bool structplace;      // last expression was a struct stored inline
+
+	Arena perm;            // objects that live until exit
+	Arena scratch;         // objects that live until the end of a function
+
+	Symbol *newvar;        // escape analysis: var being initialized
+	Symbol *argsym;        // escape analysis: var passed as a call arg
+	bool argpending;       // parsing a call arg
+	u32 addrof;            // parsing under unary & or delete()
+	Alloc *allocs;         // new() sites in the active function
+	u32 alloc_count;
+	u32 alloc_max;
+	u32 alloc_id;
 
 	Type *type_void;       // base types
 	Type *type_bool;
@@ -153,36 +263,133 @@ struct Ctx {
 	Type *type_i32;
 	Type *type_u8;
 
-	char *outptr;
-	char outbuf[4096];
+	Stats stats;
 };
 
 Ctx ctx;
 
 // ------------------------------------------------------------------
 
+void *arena_alloc(Arena *arena, size_t size, u32 kind) {
+	size = (size + 7) & ~7;
+	ctx.stats.alloc_count[kind]++;
+	ctx.stats.alloc_bytes[kind] += size;
+	if ((arena->cur == nil) || (size > (size_t) (arena->cur->limit - arena->ptr))) {
+		// move to the next chunk, reusing those kept by arena_reset()
+		Chunk *chunk = arena->cur ? arena->cur->next : arena->first;
+		if ((chunk == nil) || (size > (size_t) (chunk->limit - chunk->data))) {
+			size_t len = (size > CHUNK_SIZE) ? size : CHUNK_SIZE;
+			Chunk *fresh = malloc(sizeof(Chunk) + len);
+			if (fresh == nil) {
+				error("out of memory");
+			}
+			fresh->limit = fresh->data + len;
+			fresh->next = chunk;
+			if (arena->cur) {
+				arena->cur->next = fresh;
+			} else {
+				arena->first = fresh;
+			}
+			chunk = fresh;
+		}
+		arena->cur = chunk;
+		arena->ptr = chunk->data;
+	}
+	void *p = arena->ptr;
+	arena->ptr += size;
+	return p;
+}
+
+// release everything allocated from the arena, keeping its chunks
+void arena_reset(Arena *arena) {
+	arena->cur = nil;
+	arena->ptr = nil;
+}
+
+// FNV-1a
+u32 string_hash(const char* text, u32 len) {
+	u32 hash = 2166136261u;
+	for (u32 n = 0; n < len; n++) {
+		hash = (hash ^ ((u8) text[n])) * 16777619u;
+	}
+	return hash;
+}
+
+void string_table_grow(void) {
+	u32 size = ctx.strtab_size ? ctx.strtab_size * 2 : 1024;
+	String **tab = calloc(size, sizeof(String*));
+	if (tab == nil) {
+		error("out of memory");
+	}
+	for (u32 n = 0; n < ctx.strtab_size; n++) {
+		String *str = ctx.strtab[n];
+		if (str != nil) {
+			u32 i = str->hash & (size - 1);
+			while (tab[i] != nil) {
+				i = (i + 1) & (size - 1);
+			}
+			tab[i] = str;
+		}
+	}
+	free(ctx.strtab);
+	ctx.strtab = tab;
+	ctx.strtab_size = size;
+}
+
 String *string_make(const char* text, u32 len) {
-	// obviously this wants to be a hash table
-	String *str = ctx.stringlist;
-	while (str != nil) {
-		if ((str->len == len) && (memcmp(text, str->text, len) == 0)) {
+	// keep the load factor at or below 1/2
+	if ((ctx.strtab_count + 1) * 2 > ctx.strtab_size) {
+		string_table_grow();
+	}
+
+	u32 hash = string_hash(text, len);
+	u32 mask = ctx.strtab_size - 1;
+	u32 i = hash & mask;
+	String *str;
+	ctx.stats.intern_lookups++;
+	while ((str = ctx.strtab[i]) != nil) {
+		ctx.stats.intern_probes++;
+		if ((str->hash == hash) && (str->len == len) &&
+			(memcmp(text, str->text, len) == 0)) {
+			ctx.stats.intern_hits++;
 			return str;
 		}
-		str = str->next;
+		i = (i + 1) & mask;
 	}
 
-	str = malloc(sizeof(String) + len + 1);
+	str = arena_alloc(&ctx.perm, sizeof(String) + len + 1, ALLOC_STRING);
+	str->sym = nil;
+	str->type = nil;
+	str->token = 0;
+	str->hash = hash;
 	str->len = len;
 	memcpy(str->text, text, len);
 	str->text[len] = 0;
-	str->next = ctx.stringlist;
-	ctx.stringlist = str;
+	ctx.strtab[i] = str;
+	ctx.strtab_count++;
 
 	return str;
 }
 
+String *string_format(const char *fmt, ...) {
+	va_list ap;
+	va_start(ap, fmt);
+	int len = vsnprintf(nil, 0, fmt, ap);
+	va_end(ap);
+	char *tmp = malloc(len + 1);
+	if (tmp == nil) {
+		error("out of memory");
+	}
+	va_start(ap, fmt);
+	vsnprintf(tmp, len + 1, fmt, ap);
+	va_end(ap);
+	String *str = string_make(tmp, len);
+	free(tmp);
+	return str;
+}
+
 Scope *scope_push(u32 kind) {
-	Scope *scope = malloc(sizeof(Scope));
+	Scope *scope = arena_alloc(&ctx.scratch, sizeof(Scope), ALLOC_SCOPE);
 	scope->first = nil;
 	scope->last = nil;
 	scope->parent = ctx.scope;
@@ -191,9 +398,18 @@ Scope *scope_push(u32 kind) {
 	return scope;
 }
 
+// restore shadowed bindings, most recent first
+void symbol_unbind(Symbol *sym) {
+	if (sym != nil) {
+		symbol_unbind(sym->next);
+		sym->name->sym = sym->shadow;
+	}
+}
+
 Scope *scope_pop(void) {
 	Scope *scope = ctx.scope;
 	ctx.scope = scope->parent;
+	symbol_unbind(scope->first);
 	return scope;
 }
 
@@ -217,23 +433,40 @@ Symbol *symbol_find_in(String *name, Scope *scope) {
 	return nil;
 }
 
-// find the first surrounding scope of a specified kind
+// find the innermost visible binding of a name
 Symbol *symbol_find(String *name) {
-	for (Scope *scope = ctx.scope; scope != nil; scope = scope->parent) {
-		Symbol *sym = symbol_find_in(name, scope);
-		if (sym != nil) {
-			return sym;
-		}
-	}
-	return nil;
+	ctx.stats.symbol_lookups++;
+	return name->sym;
 }
 
 Symbol *symbol_make_in_scope(String *name, Type *type, Scope *scope) {
-	Symbol *sym = malloc(sizeof(Symbol));
+	// globals and struct fields outlive the function being parsed
+	Arena *arena = &ctx.scratch;
+	if ((scope == &ctx.global) || (scope->kind == SCOPE_STRUCT)) {
+		arena = &ctx.perm;
+	}
+	Symbol *sym = arena_alloc(arena, sizeof(Symbol), ALLOC_SYMBOL);
 	sym->name = name;
 	sym->type = type;
 	sym->next = nil;
 	sym->kind = SYMBOL_VAR;
+	sym->flags = 0;
+	sym->index = 0;
+	sym->offset = 0;
+	sym->noescape = 0;
+	if (scope == &ctx.global) {
+		// globals are outermost: bind beneath any inner bindings
+		// and beneath earlier globals of the same name
+		Symbol **link = &name->sym;
+		while (*link != nil) {
+			link = &(*link)->shadow;
+		}
+		sym->shadow = nil;
+		*link = sym;
+	} else {
+		sym->shadow = name->sym;
+		name->sym = sym;
+	}
 	if (scope->first == nil) {
 		scope->first = sym;
 	} else {
@@ -252,15 +485,21 @@ Symbol *symbol_make(String *name, Type *type) {
 }
 
 Type *type_make(String *name, u32 kind, Type *of, Symbol *fields, u32 count) {
-	Type *type = malloc(sizeof(Type));
+	Type *type = arena_alloc(&ctx.perm, sizeof(Type), ALLOC_TYPE);
 	type->name = name;
 	type->of = of;
 	type->fields = fields;
 	type->kind = kind;
 	type->count = count;
+	type->derived = nil;
+	type->fieldtab = nil;
+	type->fieldmask = 0;
+	type->size = 0;
+	type->align = 0;
 	if (name != nil) {
 		type->next = ctx.typelist;
 		ctx.typelist = type;
+		name->type = type;
 	} else {
 		type->next = nil;
 	}
@@ -268,24 +507,119 @@ Type *type_make(String *name, u32 kind, Type *of, Symbol *fields, u32 count) {
 }
 
 Type *type_find(String *name) {
-	for (Type *t = ctx.typelist; t != nil; t = t->next) {
-		if (t->name == name) {
+	return name->type;
+}
+
+// composite types are unique per (kind, of, count)
+Type *type_make_composite(u32 kind, Type *of, u32 count) {
+	for (Type *t = of->derived; t != nil; t = t->next) {
+		if ((t->kind == kind) && (t->count == count)) {
 			return t;
 		}
 	}
-	return nil;
+	Type *type = type_make(nil, kind, of, nil, count);
+	type->next = of->derived;
+	of->derived = type;
+	return type;
+}
+
+// size and alignment of a value as laid out by the C backend
+// (ref: the value is held by reference, as struct variables are)
+bool type_layout(Type *type, bool ref, u32 *size, u32 *align) {
+	if (ref || (type->kind == TYPE_STR) || (type->kind == TYPE_POINTER)) {
+		*size = *align = sizeof(void*);
+	} else if ((type->kind == TYPE_BOOL) || (type->kind == TYPE_U8)) {
+		*size = *align = 1;
+	} else if ((type->kind == TYPE_U32) || (type->kind == TYPE_ENUM)) {
+		*size = *align = 4;
+	} else if ((type->kind == TYPE_STRUCT) && (type->align != 0)) {
+		*size = type->size;
+		*align = type->align;
+	} else if (type->kind == TYPE_ARRAY) {
+		if (!type_layout(type->of, false, size, align)) {
+			return false;
+		}
+		*size *= type->count;
+	} else {
+		return false;
+	}
+	return true;
+}
+
+// small structs are searched linearly
+#define FIELD_INDEX_MIN 8
+
+// assign field ordinals and offsets, index fields of large structs
+void type_finish_struct(Type *type) {
+	u32 count = 0;
+	u32 offset = 0;
+	u32 align = 1;
+	for (Symbol *s = type->fields; s != nil; s = s->next) {
+		u32 fsize, falign;
+		s->index = count++;
+		s->offset = 0;
+		if (align == 0) {
+			continue;
+		}
+		if (!type_layout(s->type, s->kind == SYMBOL_PTR, &fsize, &falign)) {
+			// e.g. a forward referenced enum, resolved later by C
+			align = 0;
+			continue;
+		}
+		offset = (offset + falign - 1) & ~(falign - 1);
+		s->offset = offset;
+		offset += fsize;
+		if (falign > align) {
+			align = falign;
+		}
+	}
+	if (align != 0) {
+		type->size = (offset + align - 1) & ~(align - 1);
+	}
+	type->align = align;
+
+	if (count < FIELD_INDEX_MIN) {
+		return;
+	}
+	u32 size = FIELD_INDEX_MIN * 2;
+	while (size < count * 2) {
+		size *= 2;
+	}
+	type->fieldtab = arena_alloc(&ctx.perm, size * sizeof(Symbol*), ALLOC_FIELDTAB);
+	memset(type->fieldtab, 0, size * sizeof(Symbol*));
+	type->fieldmask = size - 1;
+	for (Symbol *s = type->fields; s != nil; s = s->next) {
+		u32 i = s->name->hash & type->fieldmask;
+		while (type->fieldtab[i] != nil) {
+			i = (i + 1) & type->fieldmask;
+		}
+		type->fieldtab[i] = s;
+	}
 }
 
 Symbol *type_find_field(Type *type, String *name) {
 	if (type->kind != TYPE_STRUCT) {
 		error("not a struct");
 	}
+	ctx.stats.field_lookups++;
+	if (type->fieldtab != nil) {
+		u32 i = name->hash & type->fieldmask;
+		Symbol *s;
+		while ((s = type->fieldtab[i]) != nil) {
+			ctx.stats.field_probes++;
+			if (s->name == name) {
+				return s;
+			}
+			i = (i + 1) & type->fieldmask;
+		}
+		return nil;
+	}
 	for (Symbol *s = type->fields; s != nil; s = s->next) {
+		ctx.stats.field_probes++;
 		if (s->name == name) {
 			return s;
 		}
 	}
-	error("struct has no such field '%s'", name->text);
 	return nil;
 }
 
@@ -294,30 +628,16 @@ Symbol *type_find_field(Type *type, String *name) {
 enum {
 	cfVisibleEOL   = 1,
 	cfAbortOnError = 2,
-	cfTraceCodeGen = 3,
+	cfStats        = 4,
+	cfNoLineMap    = 8,
 };
 
+void keyword_init(void);
+
 void ctx_init() {
 	memset(&ctx, 0, sizeof(ctx));
 
-	// pre-intern keywords
-	ctx.idn_if       = string_make("if", 2);
-	ctx.idn_fn       = string_make("fn", 2);
-	ctx.idn_for      = string_make("for", 3);
-	ctx.idn_var      = string_make("var", 3);
-	ctx.idn_nil      = string_make("nil", 3);
-	ctx.idn_new      = string_make("new", 3);
-	ctx.idn_case     = string_make("case", 4);
-	ctx.idn_else     = string_make("else", 4);
-	ctx.idn_enum     = string_make("enum", 4);
-	ctx.idn_true     = string_make("true", 4);
-	ctx.idn_break    = string_make("break", 5);
-	ctx.idn_while    = string_make("while", 5);
-	ctx.idn_false    = string_make("false", 5);
-	ctx.idn_switch   = string_make("switch", 6);
-	ctx.idn_struct   = string_make("struct", 6);
-	ctx.idn_return   = string_make("return", 6);
-	ctx.idn_continue = string_make("continue", 8);
+	keyword_init();
 
 	ctx.type_void    = type_make(string_make("void", 4), TYPE_VOID, nil, nil, 0);
 	ctx.type_bool    = type_make(string_make("bool", 4), TYPE_BOOL, nil, nil, 0);
@@ -327,8 +647,6 @@ void ctx_init() {
 	ctx.type_u8      = type_make(string_make("u8", 2), TYPE_U8, nil, nil, 0);
 
 	ctx.scope = &(ctx.global);
-
-	ctx.outptr = ctx.outbuf;
 }
 
 void dump_file_line(const char* fn, u32 offset);
@@ -358,53 +676,89 @@ void error(const char *fmt, ...) {
 	}
 }
 
-#define DECL ctx.fp_decl
-#define TYPE ctx.fp_type
-#define IMPL ctx.fp_impl
+#define DECL (&ctx.out_decl)
+#define TYPE (&ctx.out_type)
+#define IMPL (&ctx.out_impl)
+
+void output_grow(Output *out, size_t len) {
+	while ((out->max - out->len) < len) {
+		out->max = out->max ? out->max * 2 : 64 * 1024;
+	}
+	if ((out->data = realloc(out->data, out->max)) == nil) {
+		error("out of memory");
+	}
+}
+
+void emit_va(Output *out, const char *fmt, va_list ap) {
+	va_list aq;
+	va_copy(aq, ap);
+	size_t avail = out->max - out->len;
+	int n = vsnprintf(out->data + out->len, avail, fmt, aq);
+	va_end(aq);
+	if ((size_t) n >= avail) {
+		output_grow(out, n + 1);
+		vsnprintf(out->data + out->len, n + 1, fmt, ap);
+	}
+	out->len += n;
+}
 
-void emit(FILE* fp, const char *fmt, ...) {
+void emit(Output *out, const char *fmt, ...) {
 	va_list ap;
 	va_start(ap, fmt);
-	vfprintf(fp, fmt, ap);
+	emit_va(out, fmt, ap);
 	va_end(ap);
 }
 
-int indent = 0;
+// the next impl line maps to line of file
+void emit_impl_line(u32 line, const char *file) {
+	emit(IMPL, "#line %u \"", line);
+	for (const char *s = file; *s != 0; s++) {
+		emit(IMPL, ((*s == '"') || (*s == '\\')) ? "\\%c" : "%c", *s);
+	}
+	emit(IMPL, "\"\n");
+	ctx.impl_line = line;
+	ctx.impl_file = file;
+}
 
+// blocks indent their lines by ctx.indent, set by parse_block()
+// and initializers; any line break must end a call
 void emit_impl(const char *fmt, ...) {
+	if (ctx.impl_bol && (fmt[0] != '\n')) {
+		// every line of a statement maps to the statement's line,
+		// so a #line is needed unless the previous one flows on
+		if (ctx.linemap && ((ctx.impl_line != ctx.srcline) ||
+			(ctx.impl_file != ctx.filename))) {
+			emit_impl_line(ctx.srcline, ctx.filename);
+		}
+		if (ctx.indent > 0) {
+			output_grow(IMPL, ctx.indent * 4);
+			memset(IMPL->data + IMPL->len, ' ', ctx.indent * 4);
+			IMPL->len += ctx.indent * 4;
+		}
+	}
+	size_t start = IMPL->len;
 	va_list ap;
 	va_start(ap, fmt);
-	int n = vsnprintf(ctx.outptr, sizeof(ctx.outbuf) - (ctx.outptr - ctx.outbuf), fmt, ap);
+	emit_va(IMPL, fmt, ap);
 	va_end(ap);
-	ctx.outptr += n;
-	if (fmt[strlen(fmt) - 1] == '\n') {
-		unsigned len = ctx.outptr - ctx.outbuf;
-		// any }s reduce the indent level of the current line
-		for (unsigned n = 0; n < len; n++) {
-			if (ctx.outbuf[n] == '}') indent--;
+	for (size_t n = start; n < IMPL->len; n++) {
+		if (IMPL->data[n] == '\n') {
+			ctx.impl_line++;
 		}
-		for (int n = 0; n < indent; n++) {
-			fwrite("    ", 1, 4, ctx.fp_impl);
-		}
-		fwrite(ctx.outbuf, 1, len, ctx.fp_impl);
-		// any {s increase the indent level of the next line
-		for (unsigned n = 0; n < len; n++) {
-			if (ctx.outbuf[n] == '{') indent++;
-		}
-		ctx.outptr = ctx.outbuf;
-		ctx.outbuf[0] = 0;
 	}
+	ctx.impl_bol = (IMPL->len > start) && (IMPL->data[IMPL->len - 1] == '\n');
 }
 
 void emit_impl_str(void) {
 	u32 n = 0;
 	emit_impl("(void*) \"");
 	while (n < 256) {
-		u32 ch = ctx.tmp[n];
+		u32 ch = ctx.ident->text[n];
 		if (ch == 0) {
 			break;
 		} else if ((ch < ' ') || (ch > '~') || (ch == '"') || (ch == '\\')) {
-			emit_impl("\\x%02x", ch);
+			// octal, since a \x escape would swallow following hex digits
+			emit_impl("\\%03o", ch);
 		} else {
 			emit_impl("%c", ch);
 		}
@@ -416,71 +770,97 @@ void emit_impl_str(void) {
 #define emit_decl(fmt...) emit(DECL, fmt)
 #define emit_type(fmt...) emit(TYPE, fmt)
 
-#define KEEP_PARENS 0x10000
-
-unsigned emit_impl_oparen(void) {
-	unsigned idx = ctx.outptr - ctx.outbuf;
-	*ctx.outptr++ = '(';
-	*ctx.outptr = 0;
-	return idx;
-}
-
-void emit_impl_cparen(unsigned idx) {
-	if (idx & KEEP_PARENS) {
-		*ctx.outptr++ = ')';
-		*ctx.outptr = 0;
+void ctx_close_source(void) {
+	if (ctx.srcmapped) {
+		munmap((void*) ctx.src, ctx.srcsize);
 	} else {
-		unsigned len = ctx.outptr - ctx.outbuf;
-		idx &= 0xFFFF;
-		memmove(ctx.outbuf + idx, ctx.outbuf + idx + 1, len - idx);
-		ctx.outptr--;
+		free((void*) ctx.src);
 	}
+	ctx.src = nil;
 }
 
+// map the whole file, so the scanner can walk it in place and
+// identifiers can be interned straight out of it
 void ctx_open_source(const char* filename) {
 	ctx.filename = filename;
 	ctx.linenumber = 0;
 
-	if (ctx.fd >= 0) {
-		close(ctx.fd);
+	if (ctx.src != nil) {
+		ctx_close_source();
 	}
-	ctx.fd = open(filename, O_RDONLY);
-	if (ctx.fd < 0) {
+	int fd = open(filename, O_RDONLY);
+	struct stat st;
+	if ((fd < 0) || (fstat(fd, &st) < 0)) {
 		error("cannot open file '%s'", filename);
 	}
-	ctx.ionext = 0;
-	ctx.iolast = 0;
+	ctx.srcsize = st.st_size;
+	ctx.srcmapped = false;
+	if ((st.st_size % sysconf(_SC_PAGESIZE)) != 0) {
+		// the tail of the last page is zero filled, so it ends with NUL
+		void *p = mmap(nil, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (p != MAP_FAILED) {
+			ctx.src = p;
+			ctx.srcmapped = true;
+		}
+	}
+	if (!ctx.srcmapped) {
+		// the scanning kernels load whole aligned 16 byte blocks,
+		// so pad with zeros to the end of the block holding the NUL
+		size_t len = (ctx.srcsize + 16) & ~(size_t) 15;
+		u8 *p = aligned_alloc(16, len);
+		if (p == nil) {
+			error("out of memory");
+		}
+		size_t n = 0;
+		while (n < ctx.srcsize) {
+			ssize_t r = read(fd, p + n, ctx.srcsize - n);
+			if (r <= 0) {
+				error("cannot read file '%s'", filename);
+			}
+			n += r;
+		}
+		memset(p + n, 0, len - n);
+		ctx.src = p;
+	}
+	close(fd);
 	ctx.linenumber = 1;
-	ctx.lineoffset = 0;
 	ctx.byteoffset = 0;
 }
 
 void ctx_open_output(void) {
-	char tmp[1024];
-	ctx.nl_decl = 1;
-	ctx.nl_type = 1;
-	ctx.nl_impl = 1;
+	ctx.impl_bol = true;
 
-	sprintf(tmp, "%s.decl.h", ctx.outname);
-	if ((ctx.fp_decl = fopen(tmp, "w")) == NULL) {
-		error("cannot open output '%s'", tmp);
-	}
-
-	sprintf(tmp, "%s.type.h", ctx.outname);
-	if ((ctx.fp_type = fopen(tmp, "w")) == NULL) {
-		error("cannot open output '%s'", tmp);
-	}
-
-	sprintf(tmp, "%s.impl.c", ctx.outname);
-	if ((ctx.fp_impl = fopen(tmp, "w")) == NULL) {
-		error("cannot open output '%s'", tmp);
-	}
+	output_grow(DECL, 1);
+	output_grow(TYPE, 1);
+	output_grow(IMPL, 1);
 
 	emit_impl("#include <builtin.type.h>\n");
 	emit_impl("#include \"%s.type.h\"\n", ctx.outname);
 	emit_impl("#include \"%s.decl.h\"\n", ctx.outname);
 }
 
+void output_write(Output *out, const char *ext) {
+	char tmp[1024];
+	snprintf(tmp, sizeof(tmp), "%s.%s", ctx.outname, ext);
+	int fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0) {
+		error("cannot open output '%s'", tmp);
+	}
+	for (size_t n = 0; n < out->len; ) {
+		ssize_t r = write(fd, out->data + n, out->len - n);
+		if (r <= 0) {
+			error("cannot write output '%s'", tmp);
+		}
+		n += r;
+	}
+	close(fd);
+}
+
+void ctx_close_output(void) {
+	output_write(DECL, "decl.h");
+	output_write(TYPE, "type.h");
+	output_write(IMPL, "impl.c");
+}
 
 // ================================================================
 // lexical scanner
@@ -508,7 +888,7 @@ enum {
 	tASSIGN, tINC, tDEC,
 	tAT,
 	// Keywords
-	tNEW, tFN, tSTRUCT, tVAR, tENUM,
+	tNEW, tDELETE, tFN, tSTRUCT, tVAR, tENUM,
 	tIF, tELSE, tWHILE,
 	tBREAK, tCONTINUE, tRETURN,
 	tFOR, tSWITCH, tCASE,
@@ -528,7 +908,7 @@ const char *tnames[] = {
 	";",     ":",     ".",  ",",  "~",   "&&",  "||",  "!",
 	"=",     "++",    "--",
 	"@",
-	"new", "fn", "struct", "var", "enum",
+	"new", "delete", "fn", "struct", "var", "enum",
 	"if", "else", "while",
 	"break", "continue", "return",
 	"for", "switch", "case",
@@ -585,26 +965,99 @@ i32 unhex(u32 ch) {
 	return -1;
 }
 
-u32 scan() {
-	while (ctx.ionext == ctx.iolast) {
-		if (ctx.fd < 0) {
-			ctx.cc = 0;
-			return ctx.cc;
-		}
-		int r = read(ctx.fd, ctx.iobuffer, sizeof(ctx.iobuffer));
-		if (r <= 0) {
-			ctx.fd = -1;
-		} else {
-			ctx.iolast = r;
-			ctx.ionext = 0;
+// note the start of a line
+void lex_line(u32 pos) {
+	if (ctx.line_count == ctx.line_max) {
+		ctx.line_max = ctx.line_max ? ctx.line_max * 2 : 1024;
+		ctx.lines = realloc(ctx.lines, ctx.line_max * sizeof(u32));
+		if (ctx.lines == nil) {
+			error("out of memory");
 		}
 	}
-	ctx.cc = ctx.iobuffer[ctx.ionext];
-	ctx.ionext++;
-	ctx.byteoffset++;
+	ctx.lines[ctx.line_count++] = pos;
+}
+
+// a NUL ends the source, and is returned from then on
+u32 scan() {
+	ctx.cc = ctx.src[ctx.byteoffset];
+	if (ctx.cc != 0) {
+		ctx.byteoffset++;
+	}
 	return ctx.cc;
 }
 
+// continue scanning at p
+u32 scan_from(const u8 *p) {
+	ctx.byteoffset = p - ctx.src;
+	return scan();
+}
+
+// scanning kernels: each returns the first byte from p that is
+// not part of a run of spaces, comment text, identifier characters
+// or plain string constant characters, all of which stop at the NUL
+// ending the source
+
+#ifdef __SSE2__
+// 16 bytes at a time; loads are aligned so none can cross into a
+// page beyond the one holding the NUL
+
+#define SCAN_SIMD(name, test) \
+const u8 *name(const u8 *p) { \
+	const u8 *a = (const u8*) ((uintptr_t) p & ~(uintptr_t) 15); \
+	u32 bits = (~0u << (p - a)) & 0xFFFF; \
+	while (true) { \
+		__m128i v = _mm_load_si128((const __m128i*) a); \
+		bits &= ~_mm_movemask_epi8(test) & 0xFFFF; \
+		if (bits != 0) { \
+			return a + __builtin_ctz(bits); \
+		} \
+		a += 16; \
+		bits = 0xFFFF; \
+	} \
+}
+
+#define EQ(c) _mm_cmpeq_epi8(v, _mm_set1_epi8(c))
+// (x - lo) <= (hi - lo), unsigned
+#define IN(x, lo, hi) _mm_cmpeq_epi8(_mm_min_epu8(_mm_sub_epi8(x, _mm_set1_epi8(lo)), \
+	_mm_set1_epi8((hi) - (lo))), _mm_sub_epi8(x, _mm_set1_epi8(lo)))
+
+SCAN_SIMD(scan_spaces, _mm_or_si128(_mm_or_si128(EQ(' '), EQ('\t')), _mm_or_si128(EQ('\r'), EQ('\v'))))
+SCAN_SIMD(scan_comment, _mm_andnot_si128(_mm_or_si128(EQ('\n'), EQ(0)), _mm_set1_epi8(-1)))
+SCAN_SIMD(scan_idchars, _mm_or_si128(_mm_or_si128(EQ('_'), IN(v, '0', '9')),
+	IN(_mm_or_si128(v, _mm_set1_epi8(0x20)), 'a', 'z')))
+SCAN_SIMD(scan_strchars, _mm_andnot_si128(_mm_or_si128(_mm_or_si128(EQ('"'), EQ('\\')), EQ(0)),
+	_mm_set1_epi8(-1)))
+
+#undef IN
+#undef EQ
+#undef SCAN_SIMD
+#else
+const u8 *scan_spaces(const u8 *p) {
+	while ((*p == ' ') || (*p == '\t') || (*p == '\r') || (*p == '\v')) {
+		p++;
+	}
+	return p;
+}
+const u8 *scan_comment(const u8 *p) {
+	while ((*p != '\n') && (*p != 0)) {
+		p++;
+	}
+	return p;
+}
+const u8 *scan_idchars(const u8 *p) {
+	while ((lextab[*p] == tIDN) || (lextab[*p] == tNUM)) {
+		p++;
+	}
+	return p;
+}
+const u8 *scan_strchars(const u8 *p) {
+	while ((*p != '"') && (*p != '\\') && (*p != 0)) {
+		p++;
+	}
+	return p;
+}
+#endif
+
 u32 unescape(u32 n) {
 	if (n == 'n') {
 		return 10;
@@ -634,6 +1087,18 @@ u32 unescape(u32 n) {
 token_t scan_string(u32 cc, u32 nc) {
 	u32 n = 0;
 	while (true) {
+		if ((nc != '"') && (nc != '\\') && (nc != 0)) {
+			// copy the run of plain characters
+			const u8 *p = ctx.src + ctx.byteoffset - 1;
+			const u8 *end = scan_strchars(p);
+			if ((end - p) > (254 - n)) {
+				error("constant string too large");
+			}
+			memcpy(ctx.tmp + n, p, end - p);
+			n += end - p;
+			nc = scan_from(end);
+			continue;
+		}
 		if (nc == '"') {
 			nc = scan();
 			break;
@@ -651,39 +1116,21 @@ token_t scan_string(u32 cc, u32 nc) {
 		}
 	}
 	ctx.tmp[n] = 0;
+	ctx.ident = string_make(ctx.tmp, n);
 	return tSTR;
 }
 
-token_t scan_keyword(u32 len) {
-	ctx.tmp[len] = 0;
-	String *idn = string_make(ctx.tmp, len);
-	ctx.ident = idn;
+// pre-intern keywords, marked with their tokens
+void keyword_init(void) {
+	for (u32 tok = tNEW; tok <= tNIL; tok++) {
+		string_make(tnames[tok], strlen(tnames[tok]))->token = tok;
+	}
+}
 
-	if (len == 2) {
-		if (idn == ctx.idn_if) { return tIF; };
-		if (idn == ctx.idn_fn) { return tFN; }
-	} else if (len == 3) {
-		if (idn == ctx.idn_for) { return tFOR; }
-		if (idn == ctx.idn_var) { return tVAR; }
-		if (idn == ctx.idn_nil) { return tNIL; }
-		if (idn == ctx.idn_new) { return tNEW; }
-	} else if (len == 4) {
-		if (idn == ctx.idn_case) { return tCASE; }
-		if (idn == ctx.idn_else) { return tELSE; }
-		if (idn == ctx.idn_enum) { return tENUM; }
-		if (idn == ctx.idn_true) { return tTRUE; }
-	} else if (len == 5) {
-		if (idn == ctx.idn_break) { return tBREAK; }
-		if (idn == ctx.idn_while) { return tWHILE; }
-		if (idn == ctx.idn_false) { return tFALSE; }
-	} else if (len == 6) {
-		if (idn == ctx.idn_switch) { return tSWITCH; }
-		if (idn == ctx.idn_struct) { return tSTRUCT; }
-		if (idn == ctx.idn_return) { return tRETURN; }
-	} else if (len == 8) {
-		if (idn == ctx.idn_continue) { return tCONTINUE; }
-	}
-	return tIDN;
+token_t scan_keyword(const char *text, u32 len) {
+	String *idn = string_make(text, len);
+	ctx.ident = idn;
+	return idn->token ? idn->token : tIDN;
 }
 
 token_t scan_number(u32 cc, u32 nc) {
@@ -729,34 +1176,25 @@ token_t scan_number(u32 cc, u32 nc) {
 	return tNUM;
 }
 
-token_t scan_ident(u32 cc, u32 nc) {
-	ctx.tmp[0] = cc;
-	u32 n = 1;
-
-	while (true) {
-		u32 tok = lextab[nc];
-		if ((tok == tIDN) || (tok == tNUM)) {
-			ctx.tmp[n] = nc;
-			n++;
-			if (n == 32) { error("identifier too large"); }
-			nc = scan();
-		} else {
-			break;
-		}
-	}
-	return scan_keyword(n);
+// walks the source directly, rather than through scan()
+token_t scan_ident(void) {
+	const u8 *start = ctx.src + ctx.tokoff;
+	const u8 *p = scan_idchars(start + 1);
+	scan_from(p);
+	return scan_keyword((const char*) start, p - start);
 }
 
-token_t _next() {
+token_t lex_token() {
 	u8 nc = ctx.cc;
 	while (true) {
 		u8 cc = nc;
+		ctx.tokoff = ctx.byteoffset - (cc != 0);
 		nc = scan();
 		u32 tok = lextab[cc];
 		if (tok == tNUM) { // 0..9
 			return scan_number(cc, nc);
 		} else if (tok == tIDN) { // _ A..Z a..z
-			return scan_ident(cc, nc);
+			return scan_ident();
 		} else if (tok == tDQT) { // "
 			return scan_string(cc, nc);
 		} else if (tok == tSQT) { // '
@@ -791,19 +1229,22 @@ token_t _next() {
 		} else if (tok == tSLASH) {
 			if (nc == '/') {
 				// comment -- consume until EOL or EOF
-				while ((nc != '\n') && (nc != 0)) {
-					nc = scan();
-				}
+				nc = scan_from(scan_comment(ctx.src + ctx.byteoffset));
 				continue;
 			}
 		} else if (tok == tEOL) {
 			ctx.linenumber++;
-			ctx.lineoffset = ctx.byteoffset;
+			// the line starts at nc, which is behind byteoffset
+			// unless it is the NUL at the end
+			lex_line(ctx.byteoffset - (nc != 0));
 			if (ctx.flags & cfVisibleEOL) {
 				return tEOL;
 			}
 			continue;
 		} else if (tok == tSPC) {
+			if (lextab[nc] == tSPC) {
+				nc = scan_from(scan_spaces(ctx.src + ctx.byteoffset - 1));
+			}
 			continue;
 		} else if ((tok == tMSC) || (tok == tINV)) {
 			error("unknown character 0x%02x", cc);
@@ -824,7 +1265,7 @@ void token_printstr(FILE *fp) {
 	u32 n = 0;
 	printf("\"");
 	while (n < 256) {
-		u32 ch = ctx.tmp[n];
+		u32 ch = ctx.ident->text[n];
 		if (ch == 0) {
 			break;
 		} else if ((ch < ' ') || (ch > '~')) {
@@ -843,7 +1284,7 @@ void token_print(FILE *fp) {
 	if (ctx.tok == tNUM) {
 		fprintf(fp, "#%u ", ctx.num);
 	} else if (ctx.tok == tIDN) {
-		fprintf(fp, "@%s ", ctx.tmp);
+		fprintf(fp, "@%s ", ctx.ident->text);
 	} else if (ctx.tok == tEOL) {
 		fprintf(fp, "\n");
 	} else if (ctx.tok == tSTR) {
@@ -853,6 +1294,81 @@ void token_print(FILE *fp) {
 	}
 }
 
+// lex the whole of the current source into the token arrays
+void lex_source(void) {
+	ctx.tokcount = 0;
+	ctx.tokstr_count = 0;
+	ctx.line_count = 0;
+	lex_line(0);
+	scan();
+	token_t tok;
+	u32 open = 0; // innermost unmatched ( [ { plus one, linked through tokval
+	do {
+		tok = lex_token();
+		if (ctx.tokcount == ctx.tokmax) {
+			ctx.tokmax = ctx.tokmax ? ctx.tokmax * 2 : 4096;
+			ctx.tokkind = realloc(ctx.tokkind, ctx.tokmax * sizeof(u8));
+			ctx.tokval = realloc(ctx.tokval, ctx.tokmax * sizeof(u32));
+			ctx.tokpos = realloc(ctx.tokpos, ctx.tokmax * sizeof(u32));
+			if ((ctx.tokkind == nil) || (ctx.tokval == nil) || (ctx.tokpos == nil)) {
+				error("out of memory");
+			}
+		}
+		u32 val = 0;
+		if (tok == tNUM) {
+			val = ctx.num;
+		} else if ((tok == tIDN) || (tok == tSTR)) {
+			if (ctx.tokstr_count == ctx.tokstr_max) {
+				ctx.tokstr_max = ctx.tokstr_max ? ctx.tokstr_max * 2 : 1024;
+				ctx.tokstr = realloc(ctx.tokstr, ctx.tokstr_max * sizeof(String*));
+				if (ctx.tokstr == nil) {
+					error("out of memory");
+				}
+			}
+			val = ctx.tokstr_count;
+			ctx.tokstr[ctx.tokstr_count++] = ctx.ident;
+		} else if ((tok == tOPAREN) || (tok == tOBRACK) || (tok == tOBRACE)) {
+			val = open;
+			open = ctx.tokcount + 1;
+		} else if (((tok == tCPAREN) || (tok == tCBRACK) || (tok == tCBRACE)) && open) {
+			u32 idx = open - 1;
+			open = ctx.tokval[idx];
+			ctx.tokval[idx] = ctx.tokcount;
+		}
+		ctx.tokkind[ctx.tokcount] = tok;
+		ctx.tokval[ctx.tokcount] = val;
+		ctx.tokpos[ctx.tokcount] = ctx.tokoff;
+		ctx.tokcount++;
+	} while (tok != tEOF);
+	while (open) {
+		u32 idx = open - 1;
+		open = ctx.tokval[idx];
+		ctx.tokval[idx] = 0;
+	}
+	ctx.tokidx = 0;
+	ctx.linenumber = 1;
+}
+
+// step to the next lexed token
+token_t _next() {
+	u32 idx = ctx.tokidx;
+	token_t tok = ctx.tokkind[idx];
+	if (tok == tNUM) {
+		ctx.num = ctx.tokval[idx];
+	} else if ((tok == tIDN) || (tok == tSTR)) {
+		ctx.ident = ctx.tokstr[ctx.tokval[idx]];
+	}
+	ctx.tokoff = ctx.tokpos[idx];
+	while ((ctx.linenumber < ctx.line_count) &&
+		(ctx.lines[ctx.linenumber] <= ctx.tokoff)) {
+		ctx.linenumber++;
+	}
+	if (tok != tEOF) {
+		ctx.tokidx++;
+	}
+	return tok;
+}
+
 token_t next() {
 #if 1
 	return (ctx.tok = _next());
@@ -905,9 +1421,35 @@ int is_type(const char* typename) {
 	return !strcmp(sym->type->name->text, typename);
 }
 
+// escape analysis: note how the value of a variable is used,
+// just after its name has been parsed
+void symbol_use(Symbol *sym) {
+	u32 tok = ctx.tok;
+	if (ctx.addrof) {
+		sym->flags |= SYM_ESCAPES;
+	} else if ((tok == tDOT) || (tok == tOBRACK) || (tok == tASSIGN) ||
+		((tok & tcMASK) == tcRELOP)) {
+		// field access, reassignment, or comparison
+	} else if (ctx.argpending && ((tok == tCOMMA) || (tok == tCPAREN))) {
+		// possibly an entire call argument, checked by parse_ident()
+		ctx.argsym = sym;
+	} else {
+		sym->flags |= SYM_ESCAPES;
+	}
+}
+
 // cheesy varargs for a few special purpose functions
+// error(...) writes to the fd returned by fn_error_begin()
+// fprint(fd, ...) writes to fd
 void parse_va_call(const char* fn) {
-	emit_impl("({ int fd = fn_%s_begin();", fn);
+	emit_impl("({ int fd = fn_%s_begin(", fn);
+	if (!strcmp(fn, "fprint")) {
+		parse_expr();
+		if (ctx.tok != tCPAREN) {
+			require(tCOMMA);
+		}
+	}
+	emit_impl(");");
 	while (ctx.tok != tCPAREN) {
 		if (ctx.tok == tAT) {
 			next();
@@ -935,7 +1477,7 @@ void parse_va_call(const char* fn) {
 		}
 	}
 	next();
-	emit_impl(" fn_%s_end(); })", fn);
+	emit_impl(" fn_%s_end(%s); })", fn, strcmp(fn, "fprint") ? "" : "fd");
 }
 
 void parse_ident(void) {
@@ -950,35 +1492,66 @@ void parse_ident(void) {
 	if (ctx.tok == tOPAREN) {
 		// function call
 		next();
-		if (!strcmp(name->text, "error")) {
-			parse_va_call("error");
+		if (!strcmp(name->text, "error") || !strcmp(name->text, "fprint")) {
+			parse_va_call(name->text);
 			return;
 		}
 		emit_impl("fn_%s(", name->text);
+		u32 n = 0;
 		while (ctx.tok != tCPAREN) {
+			ctx.argpending = true;
+			ctx.argsym = nil;
 			parse_expr();
+			if (ctx.argsym != nil) {
+				// a var passed as-is only escapes if the param does
+				if ((sym == nil) || !(sym->flags & SYM_ANALYZED) ||
+					(n >= 32) || !(sym->noescape & (1u << n))) {
+					ctx.argsym->flags |= SYM_ESCAPES;
+				}
+			}
+			ctx.argpending = false;
+			ctx.argsym = nil;
 			if (ctx.tok != tCPAREN) {
 				require(tCOMMA);
 				emit_impl(", ");
 			}
+			n++;
 		}
 		next();
 		emit_impl(")");
-	} else {
-		// variable access
-		if (sym->kind == SYMBOL_DEF) {
-			emit_impl("c$%s", sym->name->text);
-		} else {
-			emit_impl("$%s", sym->name->text);
-		}
+		return;
 	}
 
+	// variable access
+	if (sym->kind == SYMBOL_DEF) {
+		emit_impl("c$%s", sym->name->text);
+		return;
+	}
+	emit_impl("$%s", sym->name->text);
+
+	// follow the type through the accessors, to tell places stored
+	// inline from references loaded out of them (nil: unknown type)
+	Type *type = sym->type;
+	bool inplace = false;  // the place is stored inline
+	bool within = true;    // ...in the object sym refers to
+	bool steps = false;
 	while (1) {
 		if (ctx.tok == tDOT) {
 			// field access
 			next();
 			String *fieldname = parse_name("field name");
 			emit_impl("->%s", fieldname->text);
+			Symbol *field = nil;
+			if ((type != nil) && (type->kind == TYPE_STRUCT)) {
+				field = type_find_field(type, fieldname);
+			}
+			if (field == nil) {
+				type = nil;
+				inplace = true;
+			} else {
+				type = field->type;
+				inplace = (field->kind == SYMBOL_FLD);
+			}
 		} else if (ctx.tok == tOBRACK) {
 			// array access
 			next();
@@ -986,13 +1559,37 @@ void parse_ident(void) {
 			parse_expr();
 			emit_impl("]");
 			require(tCBRACK);
+			inplace = true;
+			if ((type != nil) && (type->kind == TYPE_STR)) {
+				type = ctx.type_u8;
+			} else if ((type == nil) || (type->kind != TYPE_ARRAY)) {
+				type = nil;
+			} else if (type->of->kind == TYPE_POINTER) {
+				type = type->of->of;
+				inplace = false;
+			} else {
+				type = type->of;
+			}
 		} else {
-			return;
+			break;
 		}
+		within = within && inplace;
+		steps = true;
 	}
+
+	inplace = inplace && ((type == nil) ||
+		(type->kind == TYPE_STRUCT) || (type->kind == TYPE_ARRAY));
+	if (!steps || (within && (inplace || ctx.addrof))) {
+		// the value of sym, or a reference into what it refers to,
+		// which under & may be to a field or element of any type
+		symbol_use(sym);
+	}
+	ctx.structplace = inplace && (type != nil) && (type->kind == TYPE_STRUCT);
 }
 
 void parse_primary_expr(void) {
+	Symbol *newvar = ctx.newvar;
+	ctx.newvar = nil;
 	if (ctx.tok == tNUM) {
 		emit_impl("0x%x", ctx.num);
 	} else if (ctx.tok == tSTR) {
@@ -1012,8 +1609,41 @@ void parse_primary_expr(void) {
 		next();
 		require(tOPAREN);
 		String *typename = parse_name("type name");
+		if (ctx.tok == tCOMMA) {
+			// new(type, region)
+			next();
+			emit_impl("((t$%s*) rt_new(sizeof(t$%s), ", typename->text, typename->text);
+			parse_expr();
+			emit_impl("))");
+		} else if (newvar != nil) {
+			// defined by parse_function() once uses of newvar are known
+			if (ctx.alloc_count == ctx.alloc_max) {
+				ctx.alloc_max = ctx.alloc_max ? ctx.alloc_max * 2 : 32;
+				ctx.allocs = realloc(ctx.allocs, ctx.alloc_max * sizeof(Alloc));
+				if (ctx.allocs == nil) {
+					error("out of memory");
+				}
+			}
+			Alloc *a = ctx.allocs + ctx.alloc_count++;
+			a->var = newvar;
+			a->type = typename;
+			a->id = ctx.alloc_id++;
+			emit_impl("new$%u", a->id);
+		} else {
+			// typed, so it can be dereferenced to copy into an inline struct
+			emit_impl("((t$%s*) rt_new(sizeof(t$%s), 0))", typename->text, typename->text);
+		}
+		require(tCPAREN);
+		return;
+	} else if (ctx.tok == tDELETE) {
+		next();
+		require(tOPAREN);
+		emit_impl("({ __auto_type d$ = ");
+		ctx.addrof++; // deleted objects must be from the heap
+		parse_expr();
+		ctx.addrof--;
 		require(tCPAREN);
-		emit_impl("calloc(1,sizeof(t$%s))", typename->text);
+		emit_impl("; rt_delete(d$, sizeof(*d$)); })");
 		return;
 	} else if (ctx.tok == tIDN) {
 		parse_ident();
@@ -1045,76 +1675,127 @@ void parse_unary_expr(void) {
 		parse_unary_expr();
 		emit_impl(")");
 	} else if (op == tAMP) {
-		error("dereference not supported");
+		emit_impl("(&");
 		next();
+		ctx.addrof++;
 		parse_unary_expr();
+		ctx.addrof--;
+		emit_impl(")");
 	} else {
 		return parse_primary_expr();
 	}
 }
 
+// binary operator precedence levels, loosest first
+enum {
+	LEVEL_OR = 1, LEVEL_AND, LEVEL_REL, LEVEL_ADD, LEVEL_MUL,
+};
+
+// Will the expression starting at ctx.tok have an operator at
+// this level outside of its first operand?  If so it is wrapped
+// in parens, since C's precedence differs from ours.
+bool expr_has_op(u32 level) {
+	bool operand = false; // just after an operand, so an op is binary
+	for (u32 idx = ctx.tokidx - 1; idx < ctx.tokcount; idx++) {
+		u32 tok = ctx.tokkind[idx];
+		u32 op = 0;
+		if (operand) {
+			if (tok == tOR) {
+				op = LEVEL_OR;
+			} else if (tok == tAND) {
+				op = LEVEL_AND;
+			} else if ((tok & tcMASK) == tcRELOP) {
+				op = LEVEL_REL;
+			} else if ((tok & tcMASK) == tcADDOP) {
+				op = LEVEL_ADD;
+			} else if ((tok & tcMASK) == tcMULOP) {
+				op = LEVEL_MUL;
+			}
+		}
+		if (op != 0) {
+			if (op <= level) {
+				return op == level;
+			}
+			operand = false;
+		} else if ((tok == tOPAREN) || (tok == tOBRACK)) {
+			// skip the group (a call, index or subexpression)
+			if ((idx = ctx.tokval[idx]) == 0) {
+				return false;
+			}
+			operand = true;
+		} else if ((tok == tIDN) || (tok == tNUM) || (tok == tSTR) ||
+			(tok == tTRUE) || (tok == tFALSE) || (tok == tNIL)) {
+			operand = true;
+		} else if (tok == tDOT) {
+			// field access, the name follows
+			operand = false;
+		} else if (operand || ((tok != tPLUS) && (tok != tMINUS) && (tok != tBANG) &&
+			(tok != tNOT) && (tok != tAMP) && (tok != tNEW) && (tok != tDELETE))) {
+			// the end of the expression
+			return false;
+		}
+	}
+	return false;
+}
+
 void parse_mul_expr(void) {
-	unsigned x = emit_impl_oparen();
+	bool paren = expr_has_op(LEVEL_MUL);
+	if (paren) emit_impl("(");
 	parse_unary_expr();
 	while ((ctx.tok & tcMASK) == tcMULOP) {
 		emit_impl(" %s ", tnames[ctx.tok]);
 		next();
 		parse_unary_expr();
-		x |= KEEP_PARENS;
 	}
-	emit_impl_cparen(x);
+	if (paren) emit_impl(")");
 }
 
 void parse_add_expr(void) {
-	unsigned x = emit_impl_oparen();
+	bool paren = expr_has_op(LEVEL_ADD);
+	if (paren) emit_impl("(");
 	parse_mul_expr();
 	while ((ctx.tok & tcMASK) == tcADDOP) {
 		emit_impl(" %s ", tnames[ctx.tok]);
 		next();
 		parse_mul_expr();
-		x |= KEEP_PARENS;
 	}
-	emit_impl_cparen(x);
+	if (paren) emit_impl(")");
 }
 
 void parse_rel_expr(void) {
-	unsigned x = emit_impl_oparen();
+	bool paren = expr_has_op(LEVEL_REL);
+	if (paren) emit_impl("(");
 	parse_add_expr();
 	if ((ctx.tok & tcMASK) == tcRELOP) {
 		emit_impl(" %s ", tnames[ctx.tok]);
 		next();
 		parse_add_expr();
-		x |= KEEP_PARENS;
 	}
-	emit_impl_cparen(x);
+	if (paren) emit_impl(")");
 }
 
 void parse_and_expr(void) {
-	unsigned x = emit_impl_oparen();
+	bool paren = expr_has_op(LEVEL_AND);
+	if (paren) emit_impl("(");
 	parse_rel_expr();
-	if (ctx.tok == tAND) {
-		while (ctx.tok == tAND) {
-			emit_impl(" && ");
-			next();
-			parse_rel_expr();
-		}
-		x |= KEEP_PARENS;
+	while (ctx.tok == tAND) {
+		emit_impl(" && ");
+		next();
+		parse_rel_expr();
 	}
-	emit_impl_cparen(x);
+	if (paren) emit_impl(")");
 }
 
 void parse_expr(void) {
-	unsigned x = emit_impl_oparen();
+	bool paren = expr_has_op(LEVEL_OR);
+	if (paren) emit_impl("(");
 	parse_and_expr();
-	if (ctx.tok == tOR) {
-		while (ctx.tok == tOR) {
-			emit_impl(" || ");
-			next();
-			parse_and_expr();
-		}
-		x |= KEEP_PARENS;
+	while (ctx.tok == tOR) {
+		emit_impl(" || ");
+		next();
+		parse_and_expr();
 	}
-	emit_impl_cparen(x);
+	if (paren) emit_impl(")");
 }
 
 Type *parse_struct_type(String *name) {
@@ -1133,7 +1814,6 @@ Type *parse_struct_type(String *name) {
 	scope_push(SCOPE_STRUCT);
 	require(tOBRACE);
 	emit_type("typedef struct t$%s t$%s;\n", name->text, name->text);
-	emit_decl("struct t$%s {\n", name->text);
 	while (true) {
 		if (ctx.tok == tCBRACE) {
 			next();
@@ -1143,25 +1823,46 @@ Type *parse_struct_type(String *name) {
 		bool ptr = (ctx.tok == tSTAR);
 		if (ptr) next();
 		Type *type = parse_type(true);
-		emit_decl("    t$%s %s%s;\n", type->name->text, ptr ? "*" : "", fname->text);
 		Symbol *sym = symbol_make(fname, type);
 		sym->kind = ptr ? SYMBOL_PTR : SYMBOL_FLD;
 		if (ctx.tok != tCBRACE) {
 			require(tCOMMA);
 		}
 	}
-	emit_decl("};\n"); // xxx was _type
 	rectype->fields = scope_pop()->first;
+	type_finish_struct(rectype);
+
+	// emitted after the fields are parsed, so that any typedefs
+	// their types needed in decl.h come first
+	emit_decl("struct t$%s {\n", name->text);
+	for (Symbol *s = rectype->fields; s != nil; s = s->next) {
+		if (s->kind == SYMBOL_PTR) {
+			emit_decl("    t$%s *%s;\n", s->type->name->text, s->name->text);
+		} else if (s->type->kind == TYPE_STRUCT) {
+			// inline, as a 1-element array so it decays to a reference
+			emit_decl("    t$%s %s[1];\n", s->type->name->text, s->name->text);
+		} else {
+			emit_decl("    t$%s %s;\n", s->type->name->text, s->name->text);
+		}
+	}
+	emit_decl("};\n"); // xxx was _type
 	return rectype;
 }
 
+Type *type_make_pointer(Type *of) {
+	Type *type = type_make_composite(TYPE_POINTER, of, 0);
+	if (type->name == nil) {
+		type->name = string_format("%s$ptr", of->name->text);
+		emit_type("typedef t$%s *t$%s;\n", of->name->text, type->name->text);
+	}
+	return type;
+}
+
 Type *parse_array_type(void) {
-	Type *type;
 	u32 nelem = 0;
-	char tmp[256];
+	char tmp[16];
 	if (ctx.tok == tCBRACK) {
 		next();
-		type = type_make(nil, TYPE_ARRAY, parse_type(false), nil, 0);
 	} else {
 		if (ctx.tok != tNUM) {
 			error("array size must be numeric");
@@ -1169,14 +1870,34 @@ Type *parse_array_type(void) {
 		nelem = ctx.num;
 		next();
 		require(tCBRACK);
-		type = type_make(nil, TYPE_ARRAY, parse_type(false), nil, nelem);
 	}
-	sprintf(tmp, "%s$%u", type->of->name->text, nelem);
-	type->name = string_make(tmp, strlen(tmp));
+	Type *of;
+	if (ctx.tok == tSTAR) {
+		// elements are references
+		next();
+		of = type_make_pointer(parse_type(true));
+	} else {
+		of = parse_type(false);
+	}
+	Type *type = type_make_composite(TYPE_ARRAY, of, nelem);
+	if (type->name != nil) {
+		// already named and emitted
+		return type;
+	}
+	type->name = string_format("%s$%u", of->name->text, nelem);
 	if (nelem == 0) {
-		emit_type("typedef t$%s t$%s[];\n", type->of->name->text, type->name->text);
+		tmp[0] = 0;
+	} else {
+		sprintf(tmp, "%u", nelem);
+	}
+	if (of->kind == TYPE_STRUCT) {
+		// struct elements are stored inline, as 1-element arrays so
+		// each decays to a reference, and need the complete struct
+		emit_decl("typedef t$%s t$%s[%s][1];\n", of->name->text, type->name->text, tmp);
+	} else if (of->kind == TYPE_UNDEFINED) {
+		error("array of undefined struct '%s' must hold references", of->name->text);
 	} else {
-		emit_type("typedef t$%s t$%s[%u];\n", type->of->name->text, type->name->text, nelem);
+		emit_type("typedef t$%s t$%s[%s];\n", of->name->text, type->name->text, tmp);
 	}
 	return type;
 }
@@ -1242,11 +1963,11 @@ void parse_if(void) {
 		// ... else ...
 		if (ctx.tok == tIF) {
 			// ... if expr { block }
-			emit_impl("} else if ");
+			emit_impl("} else if (");
 			next();
 			parse_expr();
 			require(tOBRACE);
-			emit_impl(" {\n");
+			emit_impl(") {\n");
 			scope_push(SCOPE_BLOCK);
 			parse_block();
 			scope_pop();
@@ -1304,22 +2025,17 @@ void parse_struct_init(Symbol *var) {
 			break;
 		}
 		String *name = parse_name("field name");
-		Symbol *field = var->type->fields;
-		while (true) {
-			if (field == nil) {
-				error("structure has no '%s' field", name->text);
-			}
-			if (field->name == name) {
-				break;
-			}
-			field = field->next;
+		Symbol *field = type_find_field(var->type, name);
+		if (field == nil) {
+			error("structure has no '%s' field", name->text);
 		}
 		require(tCOLON);
 		if (ctx.tok == tOBRACE) {
+			// inline struct fields are 1-element arrays
 			next();
-			emit_impl("{");
+			emit_impl("{{");
 			parse_struct_init(field);
-			emit_impl("}");
+			emit_impl("}}");
 		} else {
 			parse_expr();
 			//emit_impl( "0x%x", ctx.num);
@@ -1356,13 +2072,20 @@ void parse_var(void) {
 			next();
 			if (type->kind == TYPE_STRUCT) {
 				emit_impl("t$%s $$%s = {\n", type->name->text, name->text);
+				ctx.indent++;
 				parse_struct_init(var);
-				emit_impl("\n};\nt$%s *$%s = &$$%s;\n",
+				emit_impl("\n");
+				ctx.indent--;
+				emit_impl("};\n");
+				emit_impl("t$%s *$%s = &$$%s;\n",
 					type->name->text, name->text, name->text);
 			} else if (type->kind == TYPE_ARRAY) {
 				emit_impl("t$%s $%s = {\n", type->name->text, name->text);
+				ctx.indent++;
 				parse_array_init(var);
-				emit_impl("\n};\n");
+				emit_impl("\n");
+				ctx.indent--;
+				emit_impl("};\n");
 			} else {
 				error("type %s cannot be initialized with {} expr", type->name->text);
 			}
@@ -1370,7 +2093,11 @@ void parse_var(void) {
 			emit_impl("t$%s %s$%s = ", type->name->text,
 				(type->kind == TYPE_STRUCT) ? "*" : "",
 				name->text);
+			if ((type->kind == TYPE_STRUCT) && (ctx.scope != &ctx.global)) {
+				ctx.newvar = var;
+			}
 			parse_expr();
+			ctx.newvar = nil;
 			emit_impl(";\n");
 		}
 	} else {
@@ -1387,10 +2114,19 @@ void parse_var(void) {
 }
 
 void parse_expr_statement(void) {
+	ctx.structplace = false;
 	parse_expr();
 	if (ctx.tok == tASSIGN) {
-		emit_impl(" = ");
 		next();
+		if (ctx.structplace) {
+			// inline structs are assigned by value
+			if (ctx.tok == tNIL) {
+				error("cannot assign nil to an inline struct");
+			}
+			emit_impl("[0] = *");
+		} else {
+			emit_impl(" = ");
+		}
 		parse_expr();
 	} else if ((ctx.tok & tcMASK) == tcAEQOP) {
 		emit_impl(" %s ", tnames[ctx.tok]);
@@ -1409,9 +2145,12 @@ void parse_expr_statement(void) {
 }
 
 void parse_block(void) {
+	ctx.indent++;
 	while (true) {
+		ctx.srcline = ctx.linenumber;
 		if (ctx.tok == tCBRACE) {
 			next();
+			ctx.indent--;
 			break;
 		} else if (ctx.tok == tRETURN) {
 			next();
@@ -1500,13 +2239,37 @@ void parse_function(void) {
 
 	require(tOBRACE);
 
+	ctx.alloc_count = 0;
 	scope_push(SCOPE_BLOCK);
 	parse_block();
 	scope_pop();
 
 	emit_impl("}\n");
 
+	// objects that do not escape live in the block declaring their var
+	for (u32 n = 0; n < ctx.alloc_count; n++) {
+		Alloc *a = ctx.allocs + n;
+		if (a->var->flags & SYM_ESCAPES) {
+			emit_decl("#define new$%u rt_new(sizeof(t$%s), 0)\n", a->id, a->type->text);
+		} else {
+			emit_decl("#define new$%u (&(t$%s){ 0 })\n", a->id, a->type->text);
+		}
+	}
+
+	// callers may pass vars to params that do not escape
+	u32 n = 0;
+	for (Symbol *s = ctx.scope->first; (s != nil) && (n < 32); s = s->next) {
+		if (!(s->flags & SYM_ESCAPES)) {
+			sym->noescape |= (1u << n);
+		}
+		n++;
+	}
+	sym->flags |= SYM_ANALYZED;
+
 	scope_pop();
+
+	// parameters and locals are all unbound now
+	arena_reset(&ctx.scratch);
 }
 
 void parse_enum_def(void) {
@@ -1541,12 +2304,15 @@ void parse_enum_def(void) {
 }
 
 void parse_begin() {
-	emit_impl("\n#include <library.impl.h>\n");
+	emit_impl("\n");
+	emit_impl("#include <library.impl.h>\n");
+	ctx.linemap = !(ctx.flags & cfNoLineMap);
 }
 
 void parse_program() {
 	next();
 	for (;;) {
+		ctx.srcline = ctx.linenumber;
 		if (ctx.tok == tENUM) {
 			next();
 			parse_enum_def();
@@ -1571,13 +2337,77 @@ void parse_program() {
 }
 
 void parse_end() {
-	emit_impl("\n#include <library.impl.c>\n");
+	if (ctx.linemap) {
+		// map what follows back to the generated file
+		char tmp[1024];
+		snprintf(tmp, sizeof(tmp), "%s.impl.c", ctx.outname);
+		ctx.linemap = false;
+		// the line after the #line is one past it
+		u32 line = 2;
+		for (size_t n = 0; n < IMPL->len; n++) {
+			if (IMPL->data[n] == '\n') {
+				line++;
+			}
+		}
+		emit_impl_line(line, tmp);
+	}
+	emit_impl("\n");
+	emit_impl("#include <library.impl.c>\n");
 }
 
 // ================================================================
 
+u64 clock_ns(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+double per(u64 n, u64 d) {
+	return d ? ((double) n) / d : 0.0;
+}
+
+void stats_report(u64 t_total) {
+	Stats *st = &ctx.stats;
+	static const char *kinds[ALLOC_KINDS] = {
+		"String", "Symbol", "Type", "Scope", "fieldtab",
+	};
+	FILE *fp = stderr;
+	fprintf(fp, "time    read  %10.3f ms\n", st->t_read / 1e6);
+	fprintf(fp, "        lex   %10.3f ms\n", st->t_lex / 1e6);
+	fprintf(fp, "        parse %10.3f ms  (with symbol resolution and emit)\n", st->t_parse / 1e6);
+	fprintf(fp, "        write %10.3f ms\n", st->t_write / 1e6);
+	fprintf(fp, "        total %10.3f ms\n", t_total / 1e6);
+	fprintf(fp, "input   %u files, %u lines, %llu bytes, %llu tokens (%.0f tokens/s)\n",
+		st->files, st->lines, (unsigned long long) st->bytes,
+		(unsigned long long) st->tokens, per(st->tokens * 1000000000ULL, t_total));
+	fprintf(fp, "intern  %u strings in %u slots, %llu lookups, %.1f%% hits, %.2f probes/lookup\n",
+		ctx.strtab_count, ctx.strtab_size, (unsigned long long) st->intern_lookups,
+		100.0 * per(st->intern_hits, st->intern_lookups),
+		per(st->intern_probes, st->intern_lookups));
+	fprintf(fp, "symbol  %llu lookups, 1 probe each\n", (unsigned long long) st->symbol_lookups);
+	fprintf(fp, "field   %llu lookups, %.2f probes/lookup\n",
+		(unsigned long long) st->field_lookups, per(st->field_probes, st->field_lookups));
+	u64 total = 0;
+	for (u32 n = 0; n < ALLOC_KINDS; n++) {
+		fprintf(fp, "%-7s %-8s %10llu bytes in %llu\n", n ? "" : "alloc", kinds[n],
+			(unsigned long long) st->alloc_bytes[n], (unsigned long long) st->alloc_count[n]);
+		total += st->alloc_bytes[n];
+	}
+	u64 tokbytes = ctx.tokmax * (sizeof(u8) + 2 * sizeof(u32)) + ctx.tokstr_max * sizeof(String*);
+	fprintf(fp, "        tokens   %10llu bytes\n", (unsigned long long) tokbytes);
+	fprintf(fp, "        lines    %10llu bytes\n", (unsigned long long) ctx.line_max * sizeof(u32));
+	fprintf(fp, "        strtab   %10llu bytes\n", (unsigned long long) ctx.strtab_size * sizeof(String*));
+	u64 outbytes = ctx.out_decl.max + ctx.out_type.max + ctx.out_impl.max;
+	fprintf(fp, "        output   %10llu bytes\n", (unsigned long long) outbytes);
+	total += tokbytes + ctx.line_max * sizeof(u32) + ctx.strtab_size * sizeof(String*) + outbytes;
+	fprintf(fp, "        total    %10llu bytes\n", (unsigned long long) total);
+}
+
 int main(int argc, char **argv) {
 	bool first = true;
+	u64 t_start = clock_ns();
+	u64 t;
 
 	ctx_init();
 	ctx.filename = "<commandline>";
@@ -1593,6 +2423,10 @@ int main(int argc, char **argv) {
 			argv++;
 		} else if (!strcmp(argv[1], "-A")) {
 			ctx.flags |= cfAbortOnError;
+		} else if (!strcmp(argv[1], "-T")) {
+			ctx.flags |= cfStats;
+		} else if (!strcmp(argv[1], "-L")) {
+			ctx.flags |= cfNoLineMap;
 		} else if (argv[1][0] == '-') {
 			error("unknown option: %s", argv[1]);
 		} else {
@@ -1601,19 +2435,25 @@ int main(int argc, char **argv) {
 				ctx.outname = ctx.filename;
 			}
 
+			t = clock_ns();
 			ctx_open_source(ctx.filename);
-			ctx.linenumber = 1;
-			ctx.lineoffset = 0;
-
-			// prime the lexer
-			scan();
-
+			ctx.stats.t_read += clock_ns() - t;
+			t = clock_ns();
+			lex_source();
+			ctx.stats.t_lex += clock_ns() - t;
+			ctx.stats.files++;
+			ctx.stats.lines += ctx.line_count;
+			ctx.stats.bytes += ctx.srcsize;
+			ctx.stats.tokens += ctx.tokcount;
+
+			t = clock_ns();
 			if (first) {
 				first = false;
 				ctx_open_output();
 				parse_begin();
 			}
 			parse_program();
+			ctx.stats.t_parse += clock_ns() - t;
 		}
 		argc--;
 		argv++;
@@ -1624,11 +2464,21 @@ int main(int argc, char **argv) {
 "usage:    compiler [ <option> | <sourcefilename> ]*\n"
 "\n"
 "options:  -o <filename>    output base name (default source name)\n"
-"          -A               abort on error\n");
+"          -A               abort on error\n"
+"          -T               report statistics\n"
+"          -L               no #line directives mapping C to source\n");
 		return 0;
 	}
 
+	t = clock_ns();
 	parse_end();
+	ctx.stats.t_parse += clock_ns() - t;
+	t = clock_ns();
+	ctx_close_output();
+	ctx.stats.t_write += clock_ns() - t;
 
+	if (ctx.flags & cfStats) {
+		stats_report(clock_ns() - t_start);
+	}
 	return 0;
 }
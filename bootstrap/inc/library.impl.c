@@ -1,38 +1,385 @@
 
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// buffered output, flushed when full, by fd_flush(), on fd_close(),
+// before blocking for input, and at exit
+// stderr is unbuffered, as with stdio, except within fprint()
+
+rt_outbuf *rt_out[RT_FD_MAX];
+
+static void rt_write_all(int fd, const t$u8 *p, size_t len) {
+	while (len > 0) {
+		ssize_t n = write(fd, p, len);
+		if (n <= 0) {
+			return;
+		}
+		p += n;
+		len -= n;
+	}
+}
+
+void fn_fd_flush(t$i32 fd) {
+	if ((fd >= 0) && (fd < RT_FD_MAX) && (rt_out[fd] != NULL)) {
+		rt_outbuf *out = rt_out[fd];
+		rt_write_all(fd, out->data, out->len);
+		out->len = 0;
+	}
+}
+
+static void rt_flush_all(void) {
+	for (int fd = 0; fd < RT_FD_MAX; fd++) {
+		fn_fd_flush(fd);
+	}
+}
+
+// the buffer for fd, or NULL if it cannot be buffered
+static rt_outbuf *rt_outbuf_get(int fd) {
+	if ((fd < 0) || (fd >= RT_FD_MAX)) {
+		return NULL;
+	}
+	if ((rt_out[fd] == NULL) && (fd != 2)) {
+		rt_out[fd] = calloc(1, sizeof(rt_outbuf));
+	}
+	return rt_out[fd];
+}
+
+static void rt_write(int fd, const void *p, size_t len) {
+	rt_outbuf *out = rt_outbuf_get(fd);
+	if (out == NULL) {
+		rt_write_all(fd, p, len);
+		return;
+	}
+	if (len > (RT_OUTBUF_SIZE - out->len)) {
+		fn_fd_flush(fd);
+		if (len >= RT_OUTBUF_SIZE) {
+			rt_write_all(fd, p, len);
+			return;
+		}
+	}
+	memcpy(out->data + out->len, p, len);
+	out->len += len;
+}
+
+// slow path of writec(): no buffer yet, or it is full
+void rt_writec_flush(t$i32 fd, t$i32 c) {
+	t$u8 x = c;
+	rt_write(fd, &x, 1);
+}
+
+// integers are formatted backwards from the end of a buffer,
+// returning the first character
+static char *rt_fmt_hex(char *end, t$u32 n, int digits) {
+	do {
+		*--end = "0123456789abcdef"[n & 15];
+		n >>= 4;
+		digits--;
+	} while ((n != 0) || (digits > 0));
+	return end;
+}
+
+static char *rt_fmt_dec(char *end, t$u32 n) {
+	do {
+		*--end = '0' + (n % 10);
+		n /= 10;
+	} while (n != 0);
+	return end;
+}
 
 void fn__hexout_(int x) {
-	printf("D %08x\n", x);
+	char tmp[16];
+	char *end = tmp + sizeof(tmp);
+	*--end = '\n';
+	char *p = rt_fmt_hex(end, x, 8);
+	*--p = ' ';
+	*--p = 'D';
+	rt_write(1, p, tmp + sizeof(tmp) - p);
 }
 
 void fn_writes(int fd, t$str s) {
-	write(fd, (void*)s, strlen((void*) s));
+	rt_write(fd, s, strlen((void*) s));
 }
 void fn_writex(int fd, int n) {
-	char tmp[64];
-	sprintf(tmp, "0x%x", n);
-	write(fd, tmp, strlen(tmp));
+	char tmp[16];
+	char *end = tmp + sizeof(tmp);
+	char *p = rt_fmt_hex(end, n, 1);
+	*--p = 'x';
+	*--p = '0';
+	rt_write(fd, p, end - p);
 }
 void fn_writei(int fd, int n) {
-	char tmp[64];
-	sprintf(tmp, "%d", n);
-	write(fd, tmp, strlen(tmp));
+	char tmp[16];
+	char *end = tmp + sizeof(tmp);
+	char *p = rt_fmt_dec(end, (n < 0) ? -(t$u32) n : (t$u32) n);
+	if (n < 0) {
+		*--p = '-';
+	}
+	rt_write(fd, p, end - p);
 }
-void fn_writec(int fd, int n) {
-	t$u8 x = n;
-	if (write(fd, &x, 1) != 1) {}
+
+// fprint(fd, ...) builds its whole line in the buffer, and for
+// stderr, which has none otherwise, lends it one until the line is
+// written out at once
+static rt_outbuf rt_err_line;
+
+t$i32 fn_fprint_begin(t$i32 fd) {
+	if (fd == 2) {
+		rt_out[2] = &rt_err_line;
+	}
+	return fd;
+}
+void fn_fprint_end(t$i32 fd) {
+	if (fd == 2) {
+		fn_fd_flush(fd);
+		rt_out[2] = NULL;
+	}
 }
 
-int fn_readc(int fd) {
-	t$u8 x;
-	if (read(fd, &x, 1) == 1) {
-		return x;
-	} else {
+rt_inbuf *rt_in[RT_FD_MAX];
+
+// the buffer for fd, or NULL if it cannot be buffered
+static rt_inbuf *rt_inbuf_get(int fd) {
+	if ((fd < 0) || (fd >= RT_FD_MAX)) {
+		return NULL;
+	}
+	if (rt_in[fd] == NULL) {
+		if ((rt_in[fd] = malloc(sizeof(rt_inbuf))) == NULL) {
+			return NULL;
+		}
+		rt_in[fd]->ptr = rt_in[fd]->end = rt_in[fd]->data;
+	}
+	return rt_in[fd];
+}
+
+// drop anything buffered, for close and seek
+static void rt_inbuf_discard(int fd) {
+	if ((fd >= 0) && (fd < RT_FD_MAX) && (rt_in[fd] != NULL)) {
+		rt_in[fd]->ptr = rt_in[fd]->end = rt_in[fd]->data;
+	}
+}
+
+// slow path of readc(): the buffer is empty
+t$i32 rt_readc_fill(t$i32 fd) {
+	rt_inbuf *in = rt_inbuf_get(fd);
+	if (in == NULL) {
+		t$u8 x;
+		return (read(fd, &x, 1) == 1) ? x : -1;
+	}
+	rt_flush_all();
+	ssize_t n = read(fd, in->data, RT_INBUF_SIZE);
+	if (n <= 0) {
 		return -1;
 	}
+	in->ptr = in->data + 1;
+	in->end = in->data + n;
+	return in->data[0];
+}
+
+// read up to len bytes, returning the count, 0 at end of file, or -1
+t$i32 fn_fd_read(t$i32 fd, t$u8 *buf, t$u32 len) {
+	rt_inbuf *in = NULL;
+	if ((fd >= 0) && (fd < RT_FD_MAX)) {
+		in = rt_in[fd];
+	}
+	if ((in != NULL) && (in->ptr < in->end)) {
+		// hand out what is buffered first
+		size_t n = in->end - in->ptr;
+		if (n > len) {
+			n = len;
+		}
+		memcpy(buf, in->ptr, n);
+		in->ptr += n;
+		return n;
+	}
+	if ((len < RT_INBUF_SIZE) && ((in = rt_inbuf_get(fd)) != NULL)) {
+		// small reads go through the buffer
+		rt_flush_all();
+		ssize_t n = read(fd, in->data, RT_INBUF_SIZE);
+		if (n <= 0) {
+			return n;
+		}
+		in->ptr = in->data;
+		in->end = in->data + n;
+		return fn_fd_read(fd, buf, len);
+	}
+	rt_flush_all();
+	return read(fd, buf, len);
+}
+
+// new() bump allocates from regions of chunks
+// region 0 is the default, others may be released all at once
+
+// chunks are aligned to their size, so delete() can find the
+// chunk, and from it the region, of any pooled object
+#define RT_CHUNK_SIZE (64 * 1024)
+
+typedef struct rt_chunk rt_chunk;
+struct rt_chunk {
+	rt_chunk *next;
+	t$i32 region;
+	_Alignas(8) t$u8 data[];
+};
+
+#define RT_CHUNK_DATA (RT_CHUNK_SIZE - offsetof(rt_chunk, data))
+
+typedef struct {
+	rt_chunk *first;
+	rt_chunk *cur;
+	t$u8 *ptr;
+	t$u8 *limit;
+	rt_chunk *large; // objects over RT_POOL_MAX, freed on release
+} rt_region;
+
+static rt_region *rt_regions;
+static int rt_region_count;
+static int rt_region_max;
+
+// delete() recycles default region objects through free lists
+// with one size class per 8 bytes, up to RT_POOL_MAX
+#define RT_POOL_MAX 1024
+
+static void *rt_pool[RT_POOL_MAX / 8 + 1];
+
+static void rt_oom(void) {
+	fprintf(stderr, "\nout of memory\n");
+	abort();
+}
+
+static rt_region *rt_region_get(int region) {
+	if ((region < 0) || (region >= rt_region_count)) {
+		fprintf(stderr, "\ninvalid region %d\n", region);
+		abort();
+	}
+	return rt_regions + region;
+}
+
+static void *rt_new_chunk(rt_region *r, t$i32 region, size_t size) {
+	// advance to the next chunk, reusing any kept by region_release()
+	rt_chunk *chunk = r->cur ? r->cur->next : r->first;
+	if (chunk == NULL) {
+		chunk = aligned_alloc(RT_CHUNK_SIZE, RT_CHUNK_SIZE);
+		if (chunk == NULL) {
+			rt_oom();
+		}
+		chunk->next = NULL;
+		chunk->region = region;
+		if (r->cur) {
+			r->cur->next = chunk;
+		} else {
+			r->first = chunk;
+		}
+	}
+	r->cur = chunk;
+	r->ptr = chunk->data + size;
+	r->limit = chunk->data + RT_CHUNK_DATA;
+	memset(chunk->data, 0, size);
+	return chunk->data;
+}
+
+// too big to pool, so each gets its own block
+static void *rt_new_large(rt_region *r, t$i32 region, size_t size) {
+	rt_chunk *large = calloc(1, offsetof(rt_chunk, data) + size);
+	if (large == NULL) {
+		rt_oom();
+	}
+	large->region = region;
+	if (region != 0) {
+		large->next = r->large;
+		r->large = large;
+	}
+	return large->data;
+}
+
+static t$u32 rt_size_class(t$u32 size) {
+	// every object can hold a free list link
+	return (size == 0) ? 8 : ((size + 7) & ~7);
+}
+
+void *rt_new(t$u32 size, t$i32 region) {
+	size = rt_size_class(size);
+	if ((region == 0) && (size <= RT_POOL_MAX)) {
+		void **p = rt_pool[size / 8];
+		if (p != NULL) {
+			rt_pool[size / 8] = *p;
+			memset(p, 0, size);
+			return p;
+		}
+	}
+	rt_region *r = rt_region_get(region);
+	if (size > RT_POOL_MAX) {
+		return rt_new_large(r, region, size);
+	}
+	if (size > (size_t) (r->limit - r->ptr)) {
+		return rt_new_chunk(r, region, size);
+	}
+	void *p = r->ptr;
+	r->ptr += size;
+	memset(p, 0, size);
+	return p;
+}
+
+// only for objects from the default region
+void rt_delete(void *p, t$u32 size) {
+	if (p == NULL) {
+		return;
+	}
+	size = rt_size_class(size);
+	rt_chunk *chunk;
+	if (size > RT_POOL_MAX) {
+		chunk = (rt_chunk*) ((t$u8*) p - offsetof(rt_chunk, data));
+	} else {
+		chunk = (rt_chunk*) ((uintptr_t) p & ~((uintptr_t) RT_CHUNK_SIZE - 1));
+	}
+	if (chunk->region != 0) {
+		fprintf(stderr, "\ncannot delete an object from region %d\n", chunk->region);
+		abort();
+	}
+	if (size > RT_POOL_MAX) {
+		free(chunk);
+		return;
+	}
+	*((void**) p) = rt_pool[size / 8];
+	rt_pool[size / 8] = p;
+}
+
+t$i32 fn_region_create(void) {
+	if (rt_region_count == rt_region_max) {
+		rt_region_max *= 2;
+		rt_regions = realloc(rt_regions, rt_region_max * sizeof(rt_region));
+		if (rt_regions == NULL) {
+			rt_oom();
+		}
+	}
+	memset(rt_regions + rt_region_count, 0, sizeof(rt_region));
+	return rt_region_count++;
+}
+
+// everything allocated in the region is released
+// its chunks are kept for reuse by later allocations in it
+void fn_region_release(t$i32 region) {
+	if (region == 0) {
+		fprintf(stderr, "\ncannot release the default region\n");
+		abort();
+	}
+	rt_region *r = rt_region_get(region);
+	r->cur = NULL;
+	r->ptr = NULL;
+	r->limit = NULL;
+	while (r->large != NULL) {
+		rt_chunk *next = r->large->next;
+		free(r->large);
+		r->large = next;
+	}
 }
 
 static int os_argc;
@@ -41,8 +388,18 @@ static char **os_argv;
 int main(int argc, char** argv) {
 	os_argc = argc;
 	os_argv = argv;
+	rt_region_max = 16;
+	rt_regions = calloc(rt_region_max, sizeof(rt_region));
+	rt_region_count = 1;
+	atexit(rt_flush_all);
 	int x = fn_start();
-	printf("X %08x\n", x);
+	char tmp[16];
+	char *end = tmp + sizeof(tmp);
+	*--end = '\n';
+	char *p = rt_fmt_hex(end, x, 8);
+	*--p = ' ';
+	*--p = 'X';
+	rt_write(1, p, tmp + sizeof(tmp) - p);
 	return 0;
 }
 
@@ -61,6 +418,28 @@ void fn_os_exit(int n) {
 	exit(n);
 }
 
+// monotonic clock in microseconds and cycle counter in units of
+// 1024 cycles, both wrapping at 32 bits: subtract two readings as
+// u32 to time intervals shorter than the wrap (about 71 minutes,
+// or 20-40 minutes of cycles at usual clock rates)
+t$u32 fn_os_clock_us(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+t$u32 fn_os_kcycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc() >> 10;
+#elif defined(__aarch64__)
+	uint64_t n;
+	__asm__ volatile("mrs %0, cntvct_el0" : "=r" (n));
+	return n >> 10;
+#else
+	return fn_os_clock_us();
+#endif
+}
+
 int fn_fd_open(t$str s) {
 	return open((void*)s, O_RDONLY, 0644);
 }
@@ -68,9 +447,13 @@ int fn_fd_create(t$str s) {
 	return open((void*)s, O_RDWR | O_CREAT | O_TRUNC, 0644);
 }
 void fn_fd_close(int fd) {
+	fn_fd_flush(fd);
+	rt_inbuf_discard(fd);
 	close(fd);
 }
 int fn_fd_set_pos(int fd, unsigned pos) {
+	fn_fd_flush(fd);
+	rt_inbuf_discard(fd);
 	if (lseek(fd, pos, SEEK_SET) == ((off_t) -1)) {
 		return -1;
 	} else {
@@ -78,10 +461,60 @@ int fn_fd_set_pos(int fd, unsigned pos) {
 	}
 }
 unsigned fn_fd_get_pos(int fd) {
-	return lseek(fd, 0, SEEK_CUR);
+	// less whatever has been read ahead
+	unsigned pos = lseek(fd, 0, SEEK_CUR);
+	if ((fd >= 0) && (fd < RT_FD_MAX) && (rt_in[fd] != NULL)) {
+		pos -= rt_in[fd]->end - rt_in[fd]->ptr;
+	}
+	// plus whatever is waiting to be written
+	if ((fd >= 0) && (fd < RT_FD_MAX) && (rt_out[fd] != NULL)) {
+		pos += rt_out[fd]->len;
+	}
+	return pos;
+}
+
+// the rest of the file, from the current position, as a str that
+// ends at the first NUL byte and stays valid until exit, or NULL
+t$str fn_fd_load(t$i32 fd) {
+	struct stat st;
+	if ((fn_fd_get_pos(fd) == 0) && (fstat(fd, &st) == 0) && S_ISREG(st.st_mode) &&
+		((st.st_size % sysconf(_SC_PAGESIZE)) != 0)) {
+		// the tail of the last page is zero filled, ending the str
+		void *p = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (p != MAP_FAILED) {
+			fn_fd_set_pos(fd, st.st_size);
+			return p;
+		}
+	}
+	// otherwise read it all, with room for a NUL
+	size_t max = 64 * 1024;
+	size_t len = 0;
+	t$u8 *buf = malloc(max + 1);
+	if (buf == NULL) {
+		rt_oom();
+	}
+	while (true) {
+		t$i32 n = fn_fd_read(fd, buf + len, max - len);
+		if (n < 0) {
+			free(buf);
+			return NULL;
+		} else if (n == 0) {
+			break;
+		}
+		len += n;
+		if (len == max) {
+			max *= 2;
+			if ((buf = realloc(buf, max + 1)) == NULL) {
+				rt_oom();
+			}
+		}
+	}
+	buf[len] = 0;
+	return buf;
 }
 
 void fn_abort(void) {
+	rt_flush_all();
 	abort();
 }
 
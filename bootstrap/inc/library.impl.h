@@ -6,16 +6,69 @@ void fn__hexout_(t$i32 x);
 void fn_writes(t$i32 fd, t$str s);
 void fn_writex(t$i32 fd, t$i32 n);
 void fn_writei(t$i32 fd, t$i32 n);
-void fn_writec(t$i32 fd, t$i32 c);
-t$i32 fn_readc(t$i32 fd);
+t$i32 fn_fprint_begin(t$i32 fd);
+void fn_fprint_end(t$i32 fd);
+void fn_fd_flush(t$i32 fd);
+t$i32 fn_fd_read(t$i32 fd, t$u8 *buf, t$u32 len);
+
+// buffered input and output, one buffer each per fd, created
+// on first use
+#define RT_FD_MAX 64
+#define RT_INBUF_SIZE (64 * 1024)
+#define RT_OUTBUF_SIZE (64 * 1024)
+
+typedef struct {
+	t$u8 *ptr;
+	t$u8 *end;
+	t$u8 data[RT_INBUF_SIZE];
+} rt_inbuf;
+
+extern rt_inbuf *rt_in[RT_FD_MAX];
+
+t$i32 rt_readc_fill(t$i32 fd);
+
+static inline t$i32 fn_readc(t$i32 fd) {
+	rt_inbuf *in;
+	if (((t$u32) fd < RT_FD_MAX) && ((in = rt_in[fd]) != NULL) && (in->ptr < in->end)) {
+		return *in->ptr++;
+	}
+	return rt_readc_fill(fd);
+}
+
+typedef struct {
+	t$u32 len;
+	t$u8 data[RT_OUTBUF_SIZE];
+} rt_outbuf;
+
+extern rt_outbuf *rt_out[RT_FD_MAX];
+
+void rt_writec_flush(t$i32 fd, t$i32 c);
+
+static inline void fn_writec(t$i32 fd, t$i32 c) {
+	rt_outbuf *out;
+	if (((t$u32) fd < RT_FD_MAX) && ((out = rt_out[fd]) != NULL) && (out->len < RT_OUTBUF_SIZE)) {
+		out->data[out->len++] = c;
+		return;
+	}
+	rt_writec_flush(fd, c);
+}
 
 t$i32 fn_fd_open(t$str s);
 t$i32 fn_fd_create(t$str s);
 void fn_fd_close(t$i32 fd);
 t$i32 fn_fd_set_pos(t$i32 fd, t$u32 pos);
 t$u32 fn_fd_get_pos(t$i32 fd);
+t$str fn_fd_load(t$i32 fd);
 
 t$u8* fn_os_arg(t$i32 n);
 t$i32 fn_os_arg_count(void);
 void fn_os_exit(t$i32 n);
+t$u32 fn_os_clock_us(void);
+t$u32 fn_os_kcycles(void);
 void fn_abort(void);
+
+t$i32 fn_region_create(void);
+void fn_region_release(t$i32 region);
+
+void *rt_new(t$u32 size, t$i32 region);
+void rt_delete(void *p, t$u32 size);
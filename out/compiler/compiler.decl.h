@@ -0,0 +1,196 @@
+t$bool fn_strneq(t$str $s1, t$str $s2, t$u32 $len);
+t$void fn_strcpyn(t$str $dst, t$str $src, t$u32 $len);
+t$u32 fn_strlen(t$str $s);
+struct t$String {
+    t$String *next;
+    t$Symbol *sym;
+    t$Type *type;
+    t$u32 token;
+    t$u32 hash;
+    t$u32 len;
+    t$str text;
+};
+struct t$StringPool {
+    t$StringPool *next;
+    t$u32 used;
+    t$u8$65536 data;
+};
+struct t$Symbol {
+    t$Symbol *next;
+    t$Symbol *shadow;
+    t$String *name;
+    t$Type *type;
+    t$SymbolKind kind;
+    t$u32 index;
+};
+struct t$Scope {
+    t$Scope *parent;
+    t$Symbol *first;
+    t$Symbol *last;
+    t$ScopeKind kind;
+};
+struct t$Type {
+    t$Type *next;
+    t$String *name;
+    t$Type *of;
+    t$Type *derived;
+    t$Symbol *list;
+    t$FieldIndex *fields;
+    t$TypeKind kind;
+    t$u32 count;
+};
+struct t$FieldIndex {
+    t$Symbol$ptr$128 slots;
+};
+t$bool fn_ast_is_relop(t$AstKind $kind);
+t$bool fn_ast_is_addop(t$AstKind $kind);
+t$bool fn_ast_is_mulop(t$AstKind $kind);
+t$bool fn_ast_is_binop(t$AstKind $kind);
+t$bool fn_ast_is_expr(t$AstKind $kind);
+t$bool fn_ast_is_stmt(t$AstKind $kind);
+struct t$Ast {
+    t$AstKind kind;
+    t$Ast *left;
+    t$Ast *right;
+    t$Ast *next;
+    t$u32 ival;
+    t$String *name;
+    t$Symbol *sym;
+    t$Type *type;
+    t$u32 srcloc;
+};
+struct t$Stats {
+    t$u32 t_load;
+    t$u32 t_parse;
+    t$u32 t_dump;
+    t$u32 files;
+    t$u32 lines;
+    t$u32 tokens;
+    t$u32 intern_lookups;
+    t$u32 intern_hits;
+    t$u32 intern_probes;
+    t$u32 symbol_lookups;
+    t$u32 field_lookups;
+    t$u32 field_probes;
+    t$u32 new_string;
+    t$u32 new_pool;
+    t$u32 new_scope;
+    t$u32 new_symbol;
+    t$u32 new_type;
+    t$u32 new_fieldindex;
+    t$u32 new_ast;
+    t$u32 pool_bytes;
+};
+struct t$Context {
+    t$str filename;
+    t$str outname;
+    t$i32 fd_in;
+    t$str src;
+    t$u32 srcpos;
+    t$u32 linenumber;
+    t$u32 lineoffset;
+    t$u32 byteoffset;
+    t$u32 flags;
+    t$u32 cc;
+    t$Token tok;
+    t$u32 num;
+    t$u8$256 tmp;
+    t$String *ident;
+    t$String$ptr$4096 strtab;
+    t$StringPool *strpool;
+    t$Type *typelist;
+    t$Scope *scope;
+    t$Scope *global;
+    t$Symbol *cur_fn;
+    t$Ast *program;
+    t$Ast *last;
+    t$Type *type_void;
+    t$Type *type_bool;
+    t$Type *type_str;
+    t$Type *type_nil;
+    t$Type *type_u32;
+    t$Type *type_i32;
+    t$Type *type_u8;
+    t$Stats stats[1];
+};
+t$u32 fn_string_hash(t$str $text, t$u32 $len);
+t$str fn_string_pool_alloc(t$u32 $len);
+t$String* fn_string_make_hashed(t$str $text, t$u32 $len, t$u32 $hash);
+t$String* fn_string_make(t$str $text, t$u32 $len);
+t$Scope* fn_scope_push(t$ScopeKind $kind);
+#define new$0 rt_new(sizeof(t$Scope), 0)
+t$void fn_symbol_unbind(t$Symbol *$sym);
+t$Symbol* fn_scope_pop(t$void);
+t$Scope* fn_scope_find(t$ScopeKind $kind);
+t$Symbol* fn_symbol_find_in(t$String *$name, t$Scope *$scope);
+t$Symbol* fn_symbol_find(t$String *$name);
+t$Symbol* fn_symbol_make_in_scope(t$String *$name, t$Type *$type, t$Scope *$scope);
+#define new$1 rt_new(sizeof(t$Symbol), 0)
+t$Symbol* fn_symbol_make_global(t$String *$name, t$Type *$type);
+t$Symbol* fn_symbol_make(t$String *$name, t$Type *$type);
+t$Type* fn_type_make(t$String *$name, t$TypeKind $kind, t$Type *$of, t$Symbol *$list, t$u32 $count);
+#define new$2 rt_new(sizeof(t$Type), 0)
+t$Type* fn_type_find(t$String *$name);
+t$Type* fn_type_make_composite(t$TypeKind $kind, t$Type *$of, t$u32 $count);
+t$void fn_type_finish_struct(t$Type *$type);
+t$Symbol* fn_type_find_field(t$Type *$type, t$String *$name);
+t$Ast* fn_ast_make(t$AstKind $kind, t$u32 $ival, t$String *$name, t$Symbol *$sym, t$Type *$type);
+#define new$3 rt_new(sizeof(t$Ast), 0)
+t$Ast* fn_ast_make_lr(t$AstKind $kind, t$Ast *$left, t$Ast *$right);
+t$Ast* fn_ast_make_l(t$AstKind $kind, t$Ast *$child);
+t$Ast* fn_ast_make_simple(t$AstKind $kind, t$u32 $x);
+t$Ast* fn_ast_make_const(t$u32 $value, t$Type *$type);
+t$Ast* fn_ast_make_symbol(t$String *$name, t$Symbol *$sym);
+t$void fn_ctx_init(t$void);
+t$i32 fn_error_begin(t$void);
+t$void fn_error_end(t$void);
+t$i32 fn_unhex(t$u32 $ch);
+t$Token fn_scan(t$void);
+t$u32 fn_unescape(t$u32 $n);
+t$Token fn_scan_string(t$u32 $cc, t$u32 $nc);
+t$Token fn_scan_keyword(t$u32 $len, t$u32 $hash);
+t$Token fn_scan_number(t$u32 $cc, t$u32 $nc);
+t$Token fn_scan_ident(t$u32 $cc, t$u32 $nc);
+t$Token fn__next(t$void);
+t$void fn_printstr(t$i32 $fd, t$str $s);
+t$void fn_token_print(t$i32 $fd);
+t$Token fn_next(t$void);
+t$void fn_expected(t$str $what);
+t$void fn_expect(t$Token $tok);
+t$void fn_require(t$Token $tok);
+t$String* fn_parse_name(t$str $what);
+t$Ast* fn_parse_symbol(t$str $what);
+t$Ast* fn_parse_ident(t$void);
+t$Ast* fn_parse_primary_expr(t$void);
+t$Ast* fn_parse_unary_expr(t$void);
+t$Ast* fn_parse_mul_expr(t$void);
+t$Ast* fn_parse_add_expr(t$void);
+t$Ast* fn_parse_rel_expr(t$void);
+t$Ast* fn_parse_and_expr(t$void);
+t$Ast* fn_parse_expr(t$void);
+t$Type* fn_parse_struct_type(t$String *$name);
+t$Type* fn_parse_array_type(t$void);
+t$Type* fn_parse_type(t$u32 $fwd_ref_ok);
+t$Ast* fn_parse_while(t$void);
+t$Ast* fn_parse_if(t$void);
+t$Ast* fn_parse_return(t$void);
+t$Ast* fn_parse_break(t$void);
+t$Ast* fn_parse_continue(t$void);
+t$void fn_parse_struct_init(t$Symbol *$sym);
+t$void fn_parse_array_init(t$Symbol *$sym);
+t$void fn_parse_var(t$void);
+t$Ast* fn__parse_expr_statement(t$void);
+t$Ast* fn_parse_expr_statement(t$void);
+t$Ast* fn_parse_block(t$void);
+t$Symbol* fn_parse_param(t$String *$fname);
+t$Ast* fn_parse_fn_body(t$Symbol *$sym);
+t$Ast* fn_parse_fn(t$void);
+t$void fn_parse_enum_def(t$void);
+t$void fn_parse_init(t$void);
+t$Ast* fn_parse_program(t$void);
+t$void fn_print_indent(t$i32 $fd);
+t$void fn__dump_ast_node(t$i32 $fd, t$Ast *$node);
+t$void fn_dump_ast_node(t$i32 $fd, t$Ast *$node);
+t$void fn_dump_ast(t$Ast *$node);
+t$void fn_print_stats(t$void);
+t$i32 fn_start(t$void);
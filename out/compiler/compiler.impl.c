@@ -0,0 +1,1816 @@
+#include <builtin.type.h>
+#include "out/compiler/compiler.type.h"
+#include "out/compiler/compiler.decl.h"
+
+#include <library.impl.h>
+#line 4 "compiler/stdlib.spl"
+t$bool fn_strneq(t$str $s1, t$str $s2, t$u32 $len) {
+    t$u32 $n = 0x0;
+    while (($n < $len)) {
+        if (($s1[$n] != $s2[$n])) {
+            return 0;
+        }
+        $n ++;
+    }
+    return 1;
+}
+#line 15 "compiler/stdlib.spl"
+t$void fn_strcpyn(t$str $dst, t$str $src, t$u32 $len) {
+    t$u32 $n = 0x0;
+    while (($n < $len)) {
+        $dst[$n] = $src[$n];
+        $n ++;
+    }
+}
+#line 23 "compiler/stdlib.spl"
+t$u32 fn_strlen(t$str $s) {
+    t$u32 $n = 0x0;
+    while (($s[$n] != 0x0)) {
+        $n ++;
+    }
+    return $n;
+}
+#line 24 "compiler/types.spl"
+#define c$SYMBOL_VAR 0x0
+#line 24 "compiler/types.spl"
+#define c$SYMBOL_FLD 0x1
+#line 24 "compiler/types.spl"
+#define c$SYMBOL_PTR 0x2
+#line 24 "compiler/types.spl"
+#define c$SYMBOL_DEF 0x3
+#line 24 "compiler/types.spl"
+#define c$SYMBOL_FN 0x4
+#line 41 "compiler/types.spl"
+#define c$SCOPE_GLOBAL 0x0
+#line 41 "compiler/types.spl"
+#define c$SCOPE_FUNC 0x1
+#line 41 "compiler/types.spl"
+#define c$SCOPE_BLOCK 0x2
+#line 41 "compiler/types.spl"
+#define c$SCOPE_LOOP 0x3
+#line 41 "compiler/types.spl"
+#define c$SCOPE_STRUCT 0x4
+#line 56 "compiler/types.spl"
+#define c$TYPE_VOID 0x0
+#line 56 "compiler/types.spl"
+#define c$TYPE_BOOL 0x1
+#line 56 "compiler/types.spl"
+#define c$TYPE_U8 0x2
+#line 56 "compiler/types.spl"
+#define c$TYPE_U32 0x3
+#line 56 "compiler/types.spl"
+#define c$TYPE_I32 0x4
+#line 56 "compiler/types.spl"
+#define c$TYPE_NIL 0x5
+#line 56 "compiler/types.spl"
+#define c$TYPE_POINTER 0x6
+#line 56 "compiler/types.spl"
+#define c$TYPE_ARRAY 0x7
+#line 56 "compiler/types.spl"
+#define c$TYPE_SLICE 0x8
+#line 56 "compiler/types.spl"
+#define c$TYPE_STR 0x9
+#line 56 "compiler/types.spl"
+#define c$TYPE_STRUCT 0xa
+#line 56 "compiler/types.spl"
+#define c$TYPE_FN 0xb
+#line 56 "compiler/types.spl"
+#define c$TYPE_ENUM 0xc
+#line 56 "compiler/types.spl"
+#define c$TYPE_UNDEFINED 0xd
+#line 90 "compiler/types.spl"
+#define c$FIELD_INDEX_MIN 0x8
+#line 90 "compiler/types.spl"
+#define c$FIELD_INDEX_MAX 0x40
+#line 98 "compiler/types.spl"
+#define c$AST_PROGRAM 0x0
+#line 98 "compiler/types.spl"
+#define c$AST_FUNC 0x1
+#line 98 "compiler/types.spl"
+#define c$AST_BLOCK 0x2
+#line 98 "compiler/types.spl"
+#define c$AST_EXPR 0x3
+#line 98 "compiler/types.spl"
+#define c$AST_WHILE 0x4
+#line 98 "compiler/types.spl"
+#define c$AST_BREAK 0x5
+#line 98 "compiler/types.spl"
+#define c$AST_CONTINUE 0x6
+#line 98 "compiler/types.spl"
+#define c$AST_RETURN 0x7
+#line 98 "compiler/types.spl"
+#define c$AST_IF 0x8
+#line 98 "compiler/types.spl"
+#define c$AST_CASE 0x9
+#line 98 "compiler/types.spl"
+#define c$AST_ELSE 0xa
+#line 98 "compiler/types.spl"
+#define c$AST_SYMBOL 0xb
+#line 98 "compiler/types.spl"
+#define c$AST_CONST 0xc
+#line 98 "compiler/types.spl"
+#define c$AST_STRING 0xd
+#line 98 "compiler/types.spl"
+#define c$AST_DEREF 0xe
+#line 98 "compiler/types.spl"
+#define c$AST_INDEX 0xf
+#line 98 "compiler/types.spl"
+#define c$AST_FIELD 0x10
+#line 98 "compiler/types.spl"
+#define c$AST_ADDROF 0x11
+#line 98 "compiler/types.spl"
+#define c$AST_CALL 0x12
+#line 98 "compiler/types.spl"
+#define c$AST_ASSIGN 0x13
+#line 98 "compiler/types.spl"
+#define c$AST_NEW 0x14
+#line 98 "compiler/types.spl"
+#define c$AST_DELETE 0x15
+#line 98 "compiler/types.spl"
+#define c$AST_EQ 0x16
+#line 98 "compiler/types.spl"
+#define c$AST_NE 0x17
+#line 98 "compiler/types.spl"
+#define c$AST_LT 0x18
+#line 98 "compiler/types.spl"
+#define c$AST_LE 0x19
+#line 98 "compiler/types.spl"
+#define c$AST_GT 0x1a
+#line 98 "compiler/types.spl"
+#define c$AST_GE 0x1b
+#line 98 "compiler/types.spl"
+#define c$AST_ADD 0x1c
+#line 98 "compiler/types.spl"
+#define c$AST_SUB 0x1d
+#line 98 "compiler/types.spl"
+#define c$AST_OR 0x1e
+#line 98 "compiler/types.spl"
+#define c$AST_XOR 0x1f
+#line 98 "compiler/types.spl"
+#define c$AST_MUL 0x20
+#line 98 "compiler/types.spl"
+#define c$AST_DIV 0x21
+#line 98 "compiler/types.spl"
+#define c$AST_MOD 0x22
+#line 98 "compiler/types.spl"
+#define c$AST_AND 0x23
+#line 98 "compiler/types.spl"
+#define c$AST_LSL 0x24
+#line 98 "compiler/types.spl"
+#define c$AST_LSR 0x25
+#line 98 "compiler/types.spl"
+#define c$AST_NOT 0x26
+#line 98 "compiler/types.spl"
+#define c$AST_BOOL_AND 0x27
+#line 98 "compiler/types.spl"
+#define c$AST_BOOL_OR 0x28
+#line 98 "compiler/types.spl"
+#define c$AST_BOOL_NOT 0x29
+#line 98 "compiler/types.spl"
+#define c$AST_NEG 0x2a
+#line 98 "compiler/types.spl"
+#define c$AST_KIND_COUNT 0x2b
+#line 139 "compiler/types.spl"
+t$str$0 $ast_kind = {
+#line 139 "compiler/types.spl"
+    (void*) "PROGRAM",(void*) "FUNC",(void*) "BLOCK",(void*) "EXPR",(void*) "WHILE",(void*) "BREAK",(void*) "CONTINUE",(void*) "RETURN",(void*) "IF",(void*) "CASE",(void*) "ELSE",(void*) "SYMBOL",(void*) "CONST",(void*) "STRING",(void*) "DEREF",(void*) "INDEX",(void*) "FIELD",(void*) "ADDROF",(void*) "CALL",(void*) "ASSIGN",(void*) "NEW",(void*) "DELETE",(void*) "EQ",(void*) "NE",(void*) "LT",(void*) "LE",(void*) "GT",(void*) "GE",(void*) "ADD",(void*) "SUB",(void*) "OR",(void*) "XOR",(void*) "MUL",(void*) "DIV",(void*) "MOD",(void*) "AND",(void*) "LSL",(void*) "LSR",(void*) "NOT",(void*) "BOOL AND",(void*) "BOOL OR",(void*) "BOOL NOT",(void*) "NEG",
+#line 139 "compiler/types.spl"
+};
+#line 151 "compiler/types.spl"
+t$bool fn_ast_is_relop(t$AstKind $kind) {
+    return (($kind >= c$AST_EQ) && ($kind <= c$AST_GE));
+}
+#line 155 "compiler/types.spl"
+t$bool fn_ast_is_addop(t$AstKind $kind) {
+    return (($kind >= c$AST_ADD) && ($kind <= c$AST_XOR));
+}
+#line 159 "compiler/types.spl"
+t$bool fn_ast_is_mulop(t$AstKind $kind) {
+    return (($kind >= c$AST_MUL) && ($kind <= c$AST_LSR));
+}
+#line 163 "compiler/types.spl"
+t$bool fn_ast_is_binop(t$AstKind $kind) {
+    return (($kind >= c$AST_EQ) && ($kind <= c$AST_LSR));
+}
+#line 167 "compiler/types.spl"
+t$bool fn_ast_is_expr(t$AstKind $kind) {
+    return ($kind >= c$AST_SYMBOL);
+}
+#line 171 "compiler/types.spl"
+t$bool fn_ast_is_stmt(t$AstKind $kind) {
+    return (($kind >= c$AST_EXPR) && ($kind <= c$AST_ELSE));
+}
+#line 195 "compiler/types.spl"
+#define c$tcRELOP 0x8
+#line 195 "compiler/types.spl"
+#define c$tcADDOP 0x10
+#line 195 "compiler/types.spl"
+#define c$tcMULOP 0x18
+#line 195 "compiler/types.spl"
+#define c$tcAEQOP 0x20
+#line 195 "compiler/types.spl"
+#define c$tcMEQOP 0x28
+#line 195 "compiler/types.spl"
+#define c$tcMASK 0xf8
+#line 200 "compiler/types.spl"
+#define c$tEOF 0x0
+#line 200 "compiler/types.spl"
+#define c$tEOL 0x1
+#line 200 "compiler/types.spl"
+#define c$tOBRACE 0x2
+#line 200 "compiler/types.spl"
+#define c$tCBRACE 0x3
+#line 200 "compiler/types.spl"
+#define c$tOBRACK 0x4
+#line 200 "compiler/types.spl"
+#define c$tCBRACK 0x5
+#line 200 "compiler/types.spl"
+#define c$tOPAREN 0x6
+#line 200 "compiler/types.spl"
+#define c$tCPAREN 0x7
+#line 200 "compiler/types.spl"
+#define c$tEQ 0x8
+#line 200 "compiler/types.spl"
+#define c$tNE 0x9
+#line 200 "compiler/types.spl"
+#define c$tLT 0xa
+#line 200 "compiler/types.spl"
+#define c$tLE 0xb
+#line 200 "compiler/types.spl"
+#define c$tGT 0xc
+#line 200 "compiler/types.spl"
+#define c$tGE 0xd
+#line 200 "compiler/types.spl"
+#define c$tx0E 0xe
+#line 200 "compiler/types.spl"
+#define c$tx0F 0xf
+#line 200 "compiler/types.spl"
+#define c$tPLUS 0x10
+#line 200 "compiler/types.spl"
+#define c$tMINUS 0x11
+#line 200 "compiler/types.spl"
+#define c$tPIPE 0x12
+#line 200 "compiler/types.spl"
+#define c$tCARET 0x13
+#line 200 "compiler/types.spl"
+#define c$tx14 0x14
+#line 200 "compiler/types.spl"
+#define c$tx15 0x15
+#line 200 "compiler/types.spl"
+#define c$tx16 0x16
+#line 200 "compiler/types.spl"
+#define c$tx17 0x17
+#line 200 "compiler/types.spl"
+#define c$tSTAR 0x18
+#line 200 "compiler/types.spl"
+#define c$tSLASH 0x19
+#line 200 "compiler/types.spl"
+#define c$tPERCENT 0x1a
+#line 200 "compiler/types.spl"
+#define c$tAMP 0x1b
+#line 200 "compiler/types.spl"
+#define c$tLEFT 0x1c
+#line 200 "compiler/types.spl"
+#define c$tRIGHT 0x1d
+#line 200 "compiler/types.spl"
+#define c$tx1E 0x1e
+#line 200 "compiler/types.spl"
+#define c$tx1F 0x1f
+#line 200 "compiler/types.spl"
+#define c$tADDEQ 0x20
+#line 200 "compiler/types.spl"
+#define c$tSUBEQ 0x21
+#line 200 "compiler/types.spl"
+#define c$tOREQ 0x22
+#line 200 "compiler/types.spl"
+#define c$tXOREQ 0x23
+#line 200 "compiler/types.spl"
+#define c$tx24 0x24
+#line 200 "compiler/types.spl"
+#define c$tx25 0x25
+#line 200 "compiler/types.spl"
+#define c$tx26 0x26
+#line 200 "compiler/types.spl"
+#define c$tx27 0x27
+#line 200 "compiler/types.spl"
+#define c$tMULEQ 0x28
+#line 200 "compiler/types.spl"
+#define c$tDIVEQ 0x29
+#line 200 "compiler/types.spl"
+#define c$tMODEQ 0x2a
+#line 200 "compiler/types.spl"
+#define c$tANDEQ 0x2b
+#line 200 "compiler/types.spl"
+#define c$tLSEQ 0x2c
+#line 200 "compiler/types.spl"
+#define c$tRSEQ 0x2d
+#line 200 "compiler/types.spl"
+#define c$t2E 0x2e
+#line 200 "compiler/types.spl"
+#define c$t2F 0x2f
+#line 200 "compiler/types.spl"
+#define c$tSEMI 0x30
+#line 200 "compiler/types.spl"
+#define c$tCOLON 0x31
+#line 200 "compiler/types.spl"
+#define c$tDOT 0x32
+#line 200 "compiler/types.spl"
+#define c$tCOMMA 0x33
+#line 200 "compiler/types.spl"
+#define c$tNOT 0x34
+#line 200 "compiler/types.spl"
+#define c$tAND 0x35
+#line 200 "compiler/types.spl"
+#define c$tOR 0x36
+#line 200 "compiler/types.spl"
+#define c$tBANG 0x37
+#line 200 "compiler/types.spl"
+#define c$tASSIGN 0x38
+#line 200 "compiler/types.spl"
+#define c$tINC 0x39
+#line 200 "compiler/types.spl"
+#define c$tDEC 0x3a
+#line 200 "compiler/types.spl"
+#define c$tAT 0x3b
+#line 200 "compiler/types.spl"
+#define c$tNEW 0x3c
+#line 200 "compiler/types.spl"
+#define c$tDELETE 0x3d
+#line 200 "compiler/types.spl"
+#define c$tFN 0x3e
+#line 200 "compiler/types.spl"
+#define c$tSTRUCT 0x3f
+#line 200 "compiler/types.spl"
+#define c$tVAR 0x40
+#line 200 "compiler/types.spl"
+#define c$tENUM 0x41
+#line 200 "compiler/types.spl"
+#define c$tIF 0x42
+#line 200 "compiler/types.spl"
+#define c$tELSE 0x43
+#line 200 "compiler/types.spl"
+#define c$tWHILE 0x44
+#line 200 "compiler/types.spl"
+#define c$tBREAK 0x45
+#line 200 "compiler/types.spl"
+#define c$tCONTINUE 0x46
+#line 200 "compiler/types.spl"
+#define c$tRETURN 0x47
+#line 200 "compiler/types.spl"
+#define c$tFOR 0x48
+#line 200 "compiler/types.spl"
+#define c$tSWITCH 0x49
+#line 200 "compiler/types.spl"
+#define c$tCASE 0x4a
+#line 200 "compiler/types.spl"
+#define c$tTRUE 0x4b
+#line 200 "compiler/types.spl"
+#define c$tFALSE 0x4c
+#line 200 "compiler/types.spl"
+#define c$tNIL 0x4d
+#line 200 "compiler/types.spl"
+#define c$tIDN 0x4e
+#line 200 "compiler/types.spl"
+#define c$tNUM 0x4f
+#line 200 "compiler/types.spl"
+#define c$tSTR 0x50
+#line 200 "compiler/types.spl"
+#define c$tSPC 0x51
+#line 200 "compiler/types.spl"
+#define c$tINV 0x52
+#line 200 "compiler/types.spl"
+#define c$tDQT 0x53
+#line 200 "compiler/types.spl"
+#define c$tSQT 0x54
+#line 200 "compiler/types.spl"
+#define c$tMSC 0x55
+#line 227 "compiler/types.spl"
+t$str$0 $tnames = {
+#line 227 "compiler/types.spl"
+    (void*) "<EOF>",(void*) "<EOL>",(void*) "{",(void*) "}",(void*) "[",(void*) "]",(void*) "(",(void*) ")",(void*) "==",(void*) "!=",(void*) "<",(void*) "<=",(void*) ">",(void*) ">=",(void*) "",(void*) "",(void*) "+",(void*) "-",(void*) "|",(void*) "^",(void*) "",(void*) "",(void*) "",(void*) "",(void*) "*",(void*) "/",(void*) "%",(void*) "&",(void*) "<<",(void*) ">>",(void*) "",(void*) "",(void*) "+=",(void*) "-=",(void*) "|=",(void*) "^=",(void*) "",(void*) "",(void*) "",(void*) "",(void*) "*=",(void*) "/=",(void*) "%=",(void*) "&=",(void*) "<<=",(void*) ">>=",(void*) "",(void*) "",(void*) ";",(void*) ":",(void*) ".",(void*) ",",(void*) "~",(void*) "&&",(void*) "||",(void*) "!",(void*) "=",(void*) "++",(void*) "--",(void*) "@",(void*) "new",(void*) "delete",(void*) "fn",(void*) "struct",(void*) "var",(void*) "enum",(void*) "if",(void*) "else",(void*) "while",(void*) "break",(void*) "continue",(void*) "return",(void*) "for",(void*) "switch",(void*) "case",(void*) "true",(void*) "false",(void*) "nil",(void*) "<ID>",(void*) "<NUM>",(void*) "<STR>",(void*) "<SPC>",(void*) "<INV>",(void*) "<DQT>",(void*) "<SQT>",(void*) "<MSC>",
+#line 227 "compiler/types.spl"
+};
+#line 273 "compiler/types.spl"
+#define c$cfStats 0x1
+#line 320 "compiler/types.spl"
+t$Context *$ctx = 0;
+#line 323 "compiler/types.spl"
+#define c$HASH_SEED 0x811c9dc5
+#line 323 "compiler/types.spl"
+#define c$HASH_MUL 0x1000193
+#line 328 "compiler/types.spl"
+t$u32 fn_string_hash(t$str $text, t$u32 $len) {
+    t$u32 $hash = c$HASH_SEED;
+    t$u32 $n = 0x0;
+    while (($n < $len)) {
+        $hash = (($hash ^ $text[$n]) * c$HASH_MUL);
+        $n ++;
+    }
+    return $hash;
+}
+#line 338 "compiler/types.spl"
+t$str fn_string_pool_alloc(t$u32 $len) {
+    t$StringPool *$pool = $ctx->strpool;
+    if ((($pool == 0) || (($pool->used + $len) > 0x10000))) {
+        $pool = ((t$StringPool*) rt_new(sizeof(t$StringPool), 0));
+        $ctx->stats->new_pool ++;
+        $pool->next = $ctx->strpool;
+        $ctx->strpool = $pool;
+    }
+    t$str $text = (&$pool->data[$pool->used]);
+    $pool->used = ($pool->used + $len);
+    $ctx->stats->pool_bytes = ($ctx->stats->pool_bytes + $len);
+    return $text;
+}
+#line 352 "compiler/types.spl"
+t$String* fn_string_make_hashed(t$str $text, t$u32 $len, t$u32 $hash) {
+    t$u32 $idx = ($hash & 0xfff);
+    t$String *$s = $ctx->strtab[$idx];
+    $ctx->stats->intern_lookups ++;
+    while (($s != 0)) {
+        $ctx->stats->intern_probes ++;
+        if ((($s->hash == $hash) && ($s->len == $len) && fn_strneq($text, $s->text, $len))) {
+            $ctx->stats->intern_hits ++;
+            return $s;
+        }
+        $s = $s->next;
+    }
+    $s = ((t$String*) rt_new(sizeof(t$String), 0));
+    $ctx->stats->new_string ++;
+    $s->hash = $hash;
+    $s->len = $len;
+    $s->text = fn_string_pool_alloc(($len + 0x1));
+    fn_strcpyn($s->text, $text, ($len + 0x1));
+    $s->next = $ctx->strtab[$idx];
+    $ctx->strtab[$idx] = $s;
+    return $s;
+}
+#line 375 "compiler/types.spl"
+t$String* fn_string_make(t$str $text, t$u32 $len) {
+    return fn_string_make_hashed($text, $len, fn_string_hash($text, $len));
+}
+#line 379 "compiler/types.spl"
+t$Scope* fn_scope_push(t$ScopeKind $kind) {
+    t$Scope *$scope = new$0;
+    $ctx->stats->new_scope ++;
+    $scope->first = 0;
+    $scope->last = 0;
+    $scope->parent = $ctx->scope;
+    $scope->kind = $kind;
+    $ctx->scope = $scope;
+    return $scope;
+}
+#line 391 "compiler/types.spl"
+t$void fn_symbol_unbind(t$Symbol *$sym) {
+    if (($sym != 0)) {
+        fn_symbol_unbind($sym->next);
+        $sym->name->sym = $sym->shadow;
+    }
+}
+#line 399 "compiler/types.spl"
+t$Symbol* fn_scope_pop(t$void) {
+    t$Scope *$scope = $ctx->scope;
+    $ctx->scope = $scope->parent;
+    fn_symbol_unbind($scope->first);
+    return $scope->first;
+}
+#line 406 "compiler/types.spl"
+t$Scope* fn_scope_find(t$ScopeKind $kind) {
+    t$Scope *$scope = $ctx->scope;
+    while (($scope != 0)) {
+        if (($scope->kind == $kind)) {
+            return $scope;
+        }
+        $scope = $scope->parent;
+    }
+    return 0;
+}
+#line 417 "compiler/types.spl"
+t$Symbol* fn_symbol_find_in(t$String *$name, t$Scope *$scope) {
+    t$Symbol *$sym = $scope->first;
+    while (($sym != 0)) {
+        if (($sym->name == $name)) {
+            return $sym;
+        }
+        $sym = $sym->next;
+    }
+    return 0;
+}
+#line 429 "compiler/types.spl"
+t$Symbol* fn_symbol_find(t$String *$name) {
+    $ctx->stats->symbol_lookups ++;
+    return $name->sym;
+}
+#line 434 "compiler/types.spl"
+t$Symbol* fn_symbol_make_in_scope(t$String *$name, t$Type *$type, t$Scope *$scope) {
+    t$Symbol *$sym = new$1;
+    $ctx->stats->new_symbol ++;
+    $sym->name = $name;
+    $sym->type = $type;
+    $sym->next = 0;
+    $sym->kind = c$SYMBOL_VAR;
+    if (($scope == $ctx->global)) {
+#line 444 "compiler/types.spl"
+        if (($name->sym == 0)) {
+            $name->sym = $sym;
+        } else {
+            t$Symbol *$link = $name->sym;
+            while (($link->shadow != 0)) {
+                $link = $link->shadow;
+            }
+            $link->shadow = $sym;
+        }
+    } else {
+        $sym->shadow = $name->sym;
+        $name->sym = $sym;
+    }
+    if (($scope->first == 0)) {
+        $scope->first = $sym;
+    } else {
+        $scope->last->next = $sym;
+    }
+    $scope->last = $sym;
+    return $sym;
+}
+#line 466 "compiler/types.spl"
+t$Symbol* fn_symbol_make_global(t$String *$name, t$Type *$type) {
+    return fn_symbol_make_in_scope($name, $type, $ctx->global);
+}
+#line 470 "compiler/types.spl"
+t$Symbol* fn_symbol_make(t$String *$name, t$Type *$type) {
+    return fn_symbol_make_in_scope($name, $type, $ctx->scope);
+}
+#line 474 "compiler/types.spl"
+t$Type* fn_type_make(t$String *$name, t$TypeKind $kind, t$Type *$of, t$Symbol *$list, t$u32 $count) {
+    t$Type *$type = new$2;
+    $ctx->stats->new_type ++;
+    $type->name = $name;
+    $type->of = $of;
+    $type->list = $list;
+    $type->kind = $kind;
+    $type->count = $count;
+    if (($name != 0)) {
+        $type->next = $ctx->typelist;
+        $ctx->typelist = $type;
+        $name->type = $type;
+    } else {
+        $type->next = 0;
+    }
+    return $type;
+}
+#line 492 "compiler/types.spl"
+t$Type* fn_type_find(t$String *$name) {
+    return $name->type;
+}
+#line 497 "compiler/types.spl"
+t$Type* fn_type_make_composite(t$TypeKind $kind, t$Type *$of, t$u32 $count) {
+    t$Type *$t = $of->derived;
+    while (($t != 0)) {
+        if ((($t->kind == $kind) && ($t->count == $count))) {
+            return $t;
+        }
+        $t = $t->next;
+    }
+    $t = fn_type_make(0, $kind, $of, 0, $count);
+    $t->next = $of->derived;
+    $of->derived = $t;
+    return $t;
+}
+#line 512 "compiler/types.spl"
+t$void fn_type_finish_struct(t$Type *$type) {
+    t$u32 $count = 0x0;
+    t$Symbol *$s = $type->list;
+    while (($s != 0)) {
+        $s->index = $count;
+        $count ++;
+        $s = $s->next;
+    }
+    if ((($count < c$FIELD_INDEX_MIN) || ($count > c$FIELD_INDEX_MAX))) {
+        return;
+    }
+    $type->fields = ((t$FieldIndex*) rt_new(sizeof(t$FieldIndex), 0));
+    $ctx->stats->new_fieldindex ++;
+    $s = $type->list;
+    while (($s != 0)) {
+        t$u32 $i = ($s->name->hash & 0x7f);
+        while (($type->fields->slots[$i] != 0)) {
+            $i = (($i + 0x1) & 0x7f);
+        }
+        $type->fields->slots[$i] = $s;
+        $s = $s->next;
+    }
+}
+#line 536 "compiler/types.spl"
+t$Symbol* fn_type_find_field(t$Type *$type, t$String *$name) {
+    if (($type->kind != c$TYPE_STRUCT)) {
+        ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "not a struct"); fn_error_end(); });
+    }
+    t$Symbol *$s = 0;
+    $ctx->stats->field_lookups ++;
+    if (($type->fields != 0)) {
+        t$u32 $i = ($name->hash & 0x7f);
+        while (1) {
+            $ctx->stats->field_probes ++;
+            $s = $type->fields->slots[$i];
+            if ((($s == 0) || ($s->name == $name))) {
+                return $s;
+            }
+            $i = (($i + 0x1) & 0x7f);
+        }
+    }
+    $s = $type->list;
+    while (($s != 0)) {
+        $ctx->stats->field_probes ++;
+        if (($s->name == $name)) {
+            return $s;
+        }
+        $s = $s->next;
+    }
+    return 0;
+}
+#line 564 "compiler/types.spl"
+t$Ast* fn_ast_make(t$AstKind $kind, t$u32 $ival, t$String *$name, t$Symbol *$sym, t$Type *$type) {
+    t$Ast *$node = new$3;
+    $ctx->stats->new_ast ++;
+    $node->kind = $kind;
+    $node->ival = $ival;
+    $node->name = $name;
+    $node->sym = $sym;
+    $node->type = $type;
+    $node->srcloc = $ctx->linenumber;
+    return $node;
+}
+#line 576 "compiler/types.spl"
+t$Ast* fn_ast_make_lr(t$AstKind $kind, t$Ast *$left, t$Ast *$right) {
+    t$Ast *$node = fn_ast_make($kind, 0x0, 0, 0, 0);
+    $node->left = $left;
+    $node->right = $right;
+    return $node;
+}
+#line 583 "compiler/types.spl"
+t$Ast* fn_ast_make_l(t$AstKind $kind, t$Ast *$child) {
+    t$Ast *$node = fn_ast_make($kind, 0x0, 0, 0, 0);
+    $node->left = $child;
+    return $node;
+}
+#line 589 "compiler/types.spl"
+t$Ast* fn_ast_make_simple(t$AstKind $kind, t$u32 $x) {
+    return fn_ast_make($kind, $x, 0, 0, 0);
+}
+#line 593 "compiler/types.spl"
+t$Ast* fn_ast_make_const(t$u32 $value, t$Type *$type) {
+    return fn_ast_make(c$AST_CONST, $value, 0, 0, $type);
+}
+#line 597 "compiler/types.spl"
+t$Ast* fn_ast_make_symbol(t$String *$name, t$Symbol *$sym) {
+#line 599 "compiler/types.spl"
+    t$Type *$type = 0;
+    if (($sym != 0)) {
+        $type = $sym->type;
+    }
+    return fn_ast_make(c$AST_SYMBOL, 0x0, $name, $sym, $type);
+}
+#line 606 "compiler/types.spl"
+t$void fn_ctx_init(t$void) {
+    $ctx = ((t$Context*) rt_new(sizeof(t$Context), 0));
+#line 610 "compiler/types.spl"
+    t$u32 $tok = c$tNEW;
+    while (($tok <= c$tNIL)) {
+        t$String *$kw = fn_string_make($tnames[$tok], fn_strlen($tnames[$tok]));
+        $kw->token = $tok;
+        $tok ++;
+    }
+#line 617 "compiler/types.spl"
+    $ctx->type_void = fn_type_make(fn_string_make((void*) "void", 0x4), c$TYPE_VOID, 0, 0, 0x0);
+    $ctx->type_bool = fn_type_make(fn_string_make((void*) "bool", 0x4), c$TYPE_BOOL, 0, 0, 0x0);
+    $ctx->type_nil = fn_type_make(fn_string_make((void*) "nil", 0x3), c$TYPE_NIL, 0, 0, 0x0);
+    $ctx->type_str = fn_type_make(fn_string_make((void*) "str", 0x3), c$TYPE_STR, 0, 0, 0x0);
+    $ctx->type_u32 = fn_type_make(fn_string_make((void*) "u32", 0x3), c$TYPE_U32, 0, 0, 0x0);
+    $ctx->type_i32 = fn_type_make(fn_string_make((void*) "i32", 0x3), c$TYPE_I32, 0, 0, 0x0);
+    $ctx->type_u8 = fn_type_make(fn_string_make((void*) "u8", 0x2), c$TYPE_U8, 0, 0, 0x0);
+#line 625 "compiler/types.spl"
+    fn_scope_push(c$SCOPE_GLOBAL);
+    $ctx->global = $ctx->scope;
+#line 628 "compiler/types.spl"
+    $ctx->linenumber = 0x1;
+    $ctx->filename = (void*) "<stdin>";
+}
+#line 6 "compiler/lexer.spl"
+t$i32 fn_error_begin(t$void) {
+    fn_fprint_begin(0x2);
+    fn_writes(0x2, (void*) "\012");
+    fn_writes(0x2, $ctx->filename);
+    fn_writes(0x2, (void*) ":");
+    fn_writei(0x2, $ctx->linenumber);
+    fn_writes(0x2, (void*) ": error: ");
+    return 0x2;
+}
+#line 16 "compiler/lexer.spl"
+t$void fn_error_end(t$void) {
+    fn_writes(0x2, (void*) "\012");
+    fn_fprint_end(0x2);
+    fn_os_exit(0x1);
+}
+#line 26 "compiler/lexer.spl"
+t$u8$256 $lextab = {
+#line 26 "compiler/lexer.spl"
+    c$tEOF,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tSPC,c$tEOL,c$tSPC,c$tINV,c$tSPC,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tSPC,c$tBANG,c$tDQT,c$tMSC,c$tMSC,c$tPERCENT,c$tAMP,c$tSQT,c$tOPAREN,c$tCPAREN,c$tSTAR,c$tPLUS,c$tCOMMA,c$tMINUS,c$tDOT,c$tSLASH,c$tNUM,c$tNUM,c$tNUM,c$tNUM,c$tNUM,c$tNUM,c$tNUM,c$tNUM,c$tNUM,c$tNUM,c$tCOLON,c$tSEMI,c$tLT,c$tASSIGN,c$tGT,c$tMSC,c$tAT,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tOBRACK,c$tMSC,c$tCBRACK,c$tCARET,c$tIDN,c$tMSC,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tIDN,c$tOBRACE,c$tPIPE,c$tCBRACE,c$tNOT,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,c$tINV,
+#line 26 "compiler/lexer.spl"
+};
+#line 73 "compiler/lexer.spl"
+t$i32 fn_unhex(t$u32 $ch) {
+    if ((($ch >= 0x30) && ($ch <= 0x39))) {
+        return ($ch - 0x30);
+    }
+    if ((($ch >= 0x61) && ($ch <= 0x66))) {
+        return ($ch - 0x61 + 0xa);
+    }
+    if ((($ch >= 0x41) && ($ch <= 0x46))) {
+        return ($ch - 0x41 + 0xa);
+    }
+    return (-0x1);
+}
+#line 86 "compiler/lexer.spl"
+t$Token fn_scan(t$void) {
+    $ctx->byteoffset ++;
+    $ctx->cc = $ctx->src[$ctx->srcpos];
+    if (($ctx->cc != 0x0)) {
+        $ctx->srcpos ++;
+    }
+    return $ctx->cc;
+}
+#line 95 "compiler/lexer.spl"
+t$u32 fn_unescape(t$u32 $n) {
+    if (($n == 0x6e)) {
+        return 0xa;
+    } else if (($n == 0x72)) {
+        return 0xd;
+    } else if (($n == 0x74)) {
+        return 0x9;
+    } else if (($n == 0x22)) {
+        return 0x22;
+    } else if (($n == 0x27)) {
+        return 0x27;
+    } else if (($n == 0x5c)) {
+        return 0x5c;
+    } else if (($n == 0x78)) {
+        t$u32 $x0 = fn_unhex(fn_scan());
+        t$u32 $x1 = fn_unhex(fn_scan());
+        if ((($x0 < 0x0) || ($x1 < 0x0))) {
+            ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "invalid hex escape"); fn_error_end(); });
+        }
+        return (($x0 << 0x4) | $x1);
+    } else {
+        ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "invalid escape "); fn_writex(fd,$n); fn_error_end(); });
+        return 0x0;
+    }
+}
+#line 121 "compiler/lexer.spl"
+t$Token fn_scan_string(t$u32 $cc, t$u32 $nc) {
+    t$u32 $n = 0x0;
+    while (1) {
+        if (($nc == 0x22)) {
+            $nc = fn_scan();
+            break;
+        } else if (($nc == 0x0)) {
+            ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "unterminated string"); fn_error_end(); });
+        } else if (($nc == 0x5c)) {
+            $ctx->tmp[$n] = fn_unescape(fn_scan());
+        } else {
+            $ctx->tmp[$n] = $nc;
+        }
+        $nc = fn_scan();
+        $n ++;
+        if (($n == 0xff)) {
+            ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "constant string too large"); fn_error_end(); });
+        }
+    }
+    $ctx->tmp[$n] = 0x0;
+    return c$tSTR;
+}
+#line 144 "compiler/lexer.spl"
+t$Token fn_scan_keyword(t$u32 $len, t$u32 $hash) {
+    $ctx->tmp[$len] = 0x0;
+    t$String *$idn = fn_string_make_hashed($ctx->tmp, $len, $hash);
+    $ctx->ident = $idn;
+#line 149 "compiler/lexer.spl"
+    if (($idn->token != 0x0)) {
+        return $idn->token;
+    }
+    return c$tIDN;
+}
+#line 155 "compiler/lexer.spl"
+t$Token fn_scan_number(t$u32 $cc, t$u32 $nc) {
+    t$u32 $n = 0x1;
+    t$u32 $val = ($cc - 0x30);
+#line 159 "compiler/lexer.spl"
+    if ((($cc == 0x30) && ($nc == 0x62))) {
+        $nc = fn_scan();
+        while ((($nc == 0x30) || ($nc == 0x31))) {
+            $val = (($val << 0x1) | ($nc - 0x30));
+            $nc = fn_scan();
+            $n ++;
+            if (($n == 0x22)) {
+                ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "binary constant too large"); fn_error_end(); });
+            }
+        }
+    } else if ((($cc == 0x30) && ($nc == 0x78))) {
+        $nc = fn_scan();
+        while (1) {
+            t$i32 $tmp = fn_unhex($nc);
+            if (($tmp == (-0x1))) {
+                break;
+            }
+            $val = (($val << 0x4) | $tmp);
+            $nc = fn_scan();
+            $n ++;
+            if (($n == 0xa)) {
+                ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "hex constant too large"); fn_error_end(); });
+            }
+        }
+    } else {
+        while (($lextab[$nc] == c$tNUM)) {
+            t$u32 $tmp = (($val * 0xa) + ($nc - 0x30));
+            if (($tmp <= $val)) {
+                ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "decimal constant too large"); fn_error_end(); });
+            }
+            $val = $tmp;
+            $nc = fn_scan();
+            $n ++;
+        }
+    }
+    $ctx->num = $val;
+    return c$tNUM;
+}
+#line 198 "compiler/lexer.spl"
+t$Token fn_scan_ident(t$u32 $cc, t$u32 $nc) {
+    $ctx->tmp[0x0] = $cc;
+    t$u32 $hash = ((c$HASH_SEED ^ $cc) * c$HASH_MUL);
+    t$u32 $n = 0x1;
+#line 203 "compiler/lexer.spl"
+    while (1) {
+        t$Token $tok = $lextab[$nc];
+        if ((($tok == c$tIDN) || ($tok == c$tNUM))) {
+            $ctx->tmp[$n] = $nc;
+            $hash = (($hash ^ $nc) * c$HASH_MUL);
+            $n ++;
+            if (($n == 0x20)) {
+#line 209 "compiler/lexer.spl"
+                ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "identifier too large"); fn_error_end(); });
+#line 209 "compiler/lexer.spl"
+            }
+            $nc = fn_scan();
+        } else {
+            break;
+        }
+    }
+    return fn_scan_keyword($n, $hash);
+}
+#line 218 "compiler/lexer.spl"
+t$Token fn__next(t$void) {
+    t$u8 $nc = $ctx->cc;
+    while (1) {
+        t$u8 $cc = $nc;
+        $nc = fn_scan();
+        t$Token $tok = $lextab[$cc];
+        if (($tok == c$tNUM)) {
+            return fn_scan_number($cc, $nc);
+        } else if (($tok == c$tIDN)) {
+            return fn_scan_ident($cc, $nc);
+        } else if (($tok == c$tDQT)) {
+            return fn_scan_string($cc, $nc);
+        } else if (($tok == c$tSQT)) {
+            $ctx->num = $nc;
+            if (($nc == 0x5c)) {
+                $ctx->num = fn_unescape(fn_scan());
+            }
+            $nc = fn_scan();
+            if (($nc != 0x27)) {
+                ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "unterminated character constant"); fn_error_end(); });
+            }
+            $nc = fn_scan();
+            return c$tNUM;
+        } else if (($tok == c$tPLUS)) {
+            if (($nc == 0x2b)) {
+#line 242 "compiler/lexer.spl"
+                $tok = c$tINC;
+#line 242 "compiler/lexer.spl"
+                $nc = fn_scan();
+#line 242 "compiler/lexer.spl"
+            }
+        } else if (($tok == c$tMINUS)) {
+            if (($nc == 0x2d)) {
+#line 244 "compiler/lexer.spl"
+                $tok = c$tDEC;
+#line 244 "compiler/lexer.spl"
+                $nc = fn_scan();
+#line 244 "compiler/lexer.spl"
+            }
+        } else if (($tok == c$tAMP)) {
+            if (($nc == 0x26)) {
+#line 246 "compiler/lexer.spl"
+                $tok = c$tAND;
+#line 246 "compiler/lexer.spl"
+                $nc = fn_scan();
+#line 246 "compiler/lexer.spl"
+            }
+        } else if (($tok == c$tPIPE)) {
+            if (($nc == 0x7c)) {
+#line 248 "compiler/lexer.spl"
+                $tok = c$tOR;
+#line 248 "compiler/lexer.spl"
+                $nc = fn_scan();
+#line 248 "compiler/lexer.spl"
+            }
+        } else if (($tok == c$tGT)) {
+            if (($nc == 0x3d)) {
+#line 250 "compiler/lexer.spl"
+                $tok = c$tGE;
+#line 250 "compiler/lexer.spl"
+                $nc = fn_scan();
+#line 250 "compiler/lexer.spl"
+            } else if (($nc == 0x3e)) {
+                $tok = c$tRIGHT;
+#line 251 "compiler/lexer.spl"
+                $nc = fn_scan();
+#line 251 "compiler/lexer.spl"
+            }
+        } else if (($tok == c$tLT)) {
+            if (($nc == 0x3d)) {
+#line 253 "compiler/lexer.spl"
+                $tok = c$tLE;
+#line 253 "compiler/lexer.spl"
+                $nc = fn_scan();
+#line 253 "compiler/lexer.spl"
+            } else if (($nc == 0x3c)) {
+                $tok = c$tLEFT;
+#line 254 "compiler/lexer.spl"
+                $nc = fn_scan();
+#line 254 "compiler/lexer.spl"
+            }
+        } else if (($tok == c$tASSIGN)) {
+            if (($nc == 0x3d)) {
+#line 256 "compiler/lexer.spl"
+                $tok = c$tEQ;
+#line 256 "compiler/lexer.spl"
+                $nc = fn_scan();
+#line 256 "compiler/lexer.spl"
+            }
+        } else if (($tok == c$tBANG)) {
+            if (($nc == 0x3d)) {
+#line 258 "compiler/lexer.spl"
+                $tok = c$tNE;
+#line 258 "compiler/lexer.spl"
+                $nc = fn_scan();
+#line 258 "compiler/lexer.spl"
+            }
+        } else if (($tok == c$tSLASH)) {
+            if (($nc == 0x2f)) {
+#line 262 "compiler/lexer.spl"
+                while ((($nc != 0xa) && ($nc != 0x0))) {
+                    $nc = fn_scan();
+                }
+                continue;
+            }
+        } else if (($tok == c$tEOL)) {
+            $ctx->linenumber ++;
+            $ctx->lineoffset = $ctx->byteoffset;
+#line 273 "compiler/lexer.spl"
+            continue;
+        } else if (($tok == c$tSPC)) {
+            continue;
+        } else if ((($tok == c$tMSC) || ($tok == c$tINV))) {
+            ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "unknown character "); fn_writex(fd,$cc); fn_error_end(); });
+        }
+#line 281 "compiler/lexer.spl"
+        if (((($tok & 0xf0) == 0x10) && ($nc == 0x3d))) {
+            $nc = fn_scan();
+#line 284 "compiler/lexer.spl"
+            $tok = ($tok + 0x10);
+        }
+#line 287 "compiler/lexer.spl"
+        return $tok;
+    }
+}
+#line 291 "compiler/lexer.spl"
+t$void fn_printstr(t$i32 $fd, t$str $s) {
+    t$u32 $n = 0x0;
+    fn_writec($fd, 0x22);
+    while (1) {
+        t$u32 $ch = $s[$n];
+        if (($ch == 0x0)) {
+            break;
+        } else if ((($ch < 0x20) || ($ch > 0x7e))) {
+            fn_writex($fd, $ch);
+        } else if ((($ch == 0x22) || ($ch == 0x5c))) {
+            fn_writec($fd, 0x5c);
+            fn_writec($fd, $ch);
+        } else {
+            fn_writec($fd, $ch);
+        }
+        $n ++;
+    }
+    fn_writec($fd, 0x22);
+}
+#line 311 "compiler/lexer.spl"
+t$void fn_token_print(t$i32 $fd) {
+    if (($ctx->tok == c$tNUM)) {
+        fn_writec($fd, 0x23);
+        fn_writex($fd, $ctx->num);
+    } else if (($ctx->tok == c$tIDN)) {
+        fn_writec($fd, 0x40);
+        fn_writes($fd, $ctx->tmp);
+    } else if (($ctx->tok == c$tEOL)) {
+        fn_writec($fd, 0xa);
+    } else if (($ctx->tok == c$tSTR)) {
+        fn_printstr($fd, $ctx->tmp);
+    } else {
+        fn_writes($fd, $tnames[$ctx->tok]);
+    }
+    fn_writec($fd, 0x20);
+}
+#line 328 "compiler/lexer.spl"
+t$Token fn_next(t$void) {
+    $ctx->tok = fn__next();
+    $ctx->stats->tokens ++;
+    return $ctx->tok;
+}
+#line 7 "compiler/parser.spl"
+t$void fn_expected(t$str $what) {
+    ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "expected "); fn_writes(fd,$what); fn_writes(fd,(void*) ", found "); fn_writes(fd,$tnames[$ctx->tok]); fn_error_end(); });
+}
+#line 11 "compiler/parser.spl"
+t$void fn_expect(t$Token $tok) {
+    if (($ctx->tok != $tok)) {
+        fn_expected($tnames[$tok]);
+    }
+}
+#line 17 "compiler/parser.spl"
+t$void fn_require(t$Token $tok) {
+    fn_expect($tok);
+    fn_next();
+}
+#line 22 "compiler/parser.spl"
+t$String* fn_parse_name(t$str $what) {
+    if (($ctx->tok != c$tIDN)) {
+        fn_expected($what);
+    }
+    t$String *$s = $ctx->ident;
+    fn_next();
+    return $s;
+}
+#line 31 "compiler/parser.spl"
+t$Ast* fn_parse_symbol(t$str $what) {
+    t$String *$name = fn_parse_name($what);
+    t$Symbol *$sym = fn_symbol_find($name);
+    return fn_ast_make_symbol($name, $sym);
+}
+#line 37 "compiler/parser.spl"
+t$Ast* fn_parse_ident(t$void) {
+    t$Ast *$node = fn_parse_symbol((void*) "identifier");
+#line 40 "compiler/parser.spl"
+    if ((($node->sym == 0) && ($ctx->tok != c$tOPAREN))) {
+        ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "undefined identifier '"); fn_writes(fd,$node->name->text); fn_writes(fd,(void*) "'"); fn_error_end(); });
+    }
+#line 44 "compiler/parser.spl"
+    if (($ctx->tok == c$tOPAREN)) {
+#line 46 "compiler/parser.spl"
+        fn_next();
+        $node = fn_ast_make_l(c$AST_CALL, $node);
+        t$Ast *$last = 0;
+#line 50 "compiler/parser.spl"
+        while (($ctx->tok != c$tCPAREN)) {
+            if (($ctx->tok == c$tAT)) {
+#line 53 "compiler/parser.spl"
+                fn_next();
+                fn_parse_type(0);
+            }
+#line 57 "compiler/parser.spl"
+            t$Ast *$expr = fn_parse_expr();
+            if (($last != 0)) {
+                $last->next = $expr;
+            } else {
+                $node->right = $expr;
+            }
+            $last = $expr;
+#line 65 "compiler/parser.spl"
+            if (($ctx->tok != c$tCPAREN)) {
+                fn_require(c$tCOMMA);
+            }
+        }
+        fn_next();
+    }
+#line 72 "compiler/parser.spl"
+    while (1) {
+        if (($ctx->tok == c$tDOT)) {
+#line 75 "compiler/parser.spl"
+            fn_next();
+            $node = fn_ast_make_lr(c$AST_FIELD, $node, fn_parse_symbol((void*) "field name"));
+        } else if (($ctx->tok == c$tOBRACK)) {
+#line 79 "compiler/parser.spl"
+            fn_next();
+            $node = fn_ast_make_lr(c$AST_INDEX, $node, fn_parse_expr());
+            fn_require(c$tCBRACK);
+        } else {
+            return $node;
+        }
+    }
+#line 87 "compiler/parser.spl"
+    return 0;
+}
+#line 90 "compiler/parser.spl"
+t$Ast* fn_parse_primary_expr(t$void) {
+    t$Ast *$node = 0;
+    if (($ctx->tok == c$tNUM)) {
+        $node = fn_ast_make_const($ctx->num, $ctx->type_i32);
+        fn_next();
+    } else if (($ctx->tok == c$tSTR)) {
+        $node = fn_ast_make_simple(c$AST_STRING, 0x0);
+        $node->name = fn_string_make($ctx->tmp, fn_strlen($ctx->tmp));
+        fn_next();
+    } else if (($ctx->tok == c$tTRUE)) {
+        $node = fn_ast_make_const(0x1, $ctx->type_bool);
+        fn_next();
+    } else if (($ctx->tok == c$tFALSE)) {
+        $node = fn_ast_make_const(0x0, $ctx->type_bool);
+        fn_next();
+    } else if (($ctx->tok == c$tNIL)) {
+        $node = fn_ast_make_const(0x0, $ctx->type_nil);
+        fn_next();
+    } else if (($ctx->tok == c$tOPAREN)) {
+        fn_next();
+        $node = fn_parse_expr();
+        fn_require(c$tCPAREN);
+    } else if (($ctx->tok == c$tNEW)) {
+        fn_next();
+        fn_require(c$tOPAREN);
+        $node = fn_ast_make_simple(c$AST_NEW, 0x0);
+        $node->name = fn_parse_name((void*) "type name");
+        if (($ctx->tok == c$tCOMMA)) {
+#line 119 "compiler/parser.spl"
+            fn_next();
+            $node->right = fn_parse_expr();
+        }
+        fn_require(c$tCPAREN);
+    } else if (($ctx->tok == c$tDELETE)) {
+        fn_next();
+        fn_require(c$tOPAREN);
+        $node = fn_ast_make_l(c$AST_DELETE, fn_parse_expr());
+        fn_require(c$tCPAREN);
+    } else if (($ctx->tok == c$tIDN)) {
+        $node = fn_parse_ident();
+    } else {
+        ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "invalid expression"); fn_error_end(); });
+    }
+    return $node;
+}
+#line 136 "compiler/parser.spl"
+t$Ast* fn_parse_unary_expr(t$void) {
+    t$u32 $op = $ctx->tok;
+    if (($op == c$tPLUS)) {
+        fn_next();
+        return fn_parse_unary_expr();
+    } else if (($op == c$tMINUS)) {
+        fn_next();
+        return fn_ast_make_l(c$AST_NEG, fn_parse_unary_expr());
+    } else if (($op == c$tBANG)) {
+        fn_next();
+        return fn_ast_make_l(c$AST_BOOL_NOT, fn_parse_unary_expr());
+    } else if (($op == c$tNOT)) {
+        fn_next();
+        return fn_ast_make_l(c$AST_NOT, fn_parse_unary_expr());
+    } else if (($op == c$tAMP)) {
+        fn_next();
+        return fn_ast_make_l(c$AST_ADDROF, fn_parse_unary_expr());
+    } else {
+        return fn_parse_primary_expr();
+    }
+    return 0;
+}
+#line 159 "compiler/parser.spl"
+t$Ast* fn_parse_mul_expr(t$void) {
+    t$Ast *$node = fn_parse_unary_expr();
+    while ((($ctx->tok & c$tcMASK) == c$tcMULOP)) {
+        t$u32 $op = (($ctx->tok - c$tSTAR) + c$AST_MUL);
+        fn_next();
+        $node = fn_ast_make_lr($op, $node, fn_parse_unary_expr());
+    }
+    return $node;
+}
+#line 169 "compiler/parser.spl"
+t$Ast* fn_parse_add_expr(t$void) {
+    t$Ast *$node = fn_parse_mul_expr();
+    while ((($ctx->tok & c$tcMASK) == c$tcADDOP)) {
+        t$u32 $op = (($ctx->tok - c$tPLUS) + c$AST_ADD);
+        fn_next();
+        $node = fn_ast_make_lr($op, $node, fn_parse_mul_expr());
+    }
+    return $node;
+}
+#line 179 "compiler/parser.spl"
+t$Ast* fn_parse_rel_expr(t$void) {
+    t$Ast *$node = fn_parse_add_expr();
+    if ((($ctx->tok & c$tcMASK) == c$tcRELOP)) {
+        t$u32 $op = (($ctx->tok - c$tEQ) + c$AST_EQ);
+        fn_next();
+        $node = fn_ast_make_lr($op, $node, fn_parse_add_expr());
+    }
+    return $node;
+}
+#line 189 "compiler/parser.spl"
+t$Ast* fn_parse_and_expr(t$void) {
+    t$Ast *$node = fn_parse_rel_expr();
+    if (($ctx->tok == c$tAND)) {
+        while (($ctx->tok == c$tAND)) {
+            fn_next();
+            $node = fn_ast_make_lr(c$AST_BOOL_AND, $node, fn_parse_rel_expr());
+        }
+    }
+    return $node;
+}
+#line 200 "compiler/parser.spl"
+t$Ast* fn_parse_expr(t$void) {
+    t$Ast *$node = fn_parse_and_expr();
+    if (($ctx->tok == c$tOR)) {
+        while (($ctx->tok == c$tOR)) {
+            fn_next();
+            $node = fn_ast_make_lr(c$AST_BOOL_OR, $node, fn_parse_and_expr());
+        }
+    }
+    return $node;
+}
+#line 211 "compiler/parser.spl"
+t$Type* fn_parse_struct_type(t$String *$name) {
+    t$Type *$type = fn_type_find($name);
+#line 214 "compiler/parser.spl"
+    if (($type == 0)) {
+        $type = fn_type_make($name, c$TYPE_STRUCT, 0, 0, 0x0);
+    } else {
+        if (($type->kind == c$TYPE_UNDEFINED)) {
+#line 219 "compiler/parser.spl"
+            $type->kind = c$TYPE_STRUCT;
+        } else {
+            ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "cannot redefine struct '"); fn_writes(fd,$name->text); fn_writes(fd,(void*) "'"); fn_error_end(); });
+        }
+    }
+    fn_scope_push(c$SCOPE_STRUCT);
+    fn_require(c$tOBRACE);
+    while (1) {
+        if (($ctx->tok == c$tCBRACE)) {
+            fn_next();
+            break;
+        }
+        t$String *$fname = fn_parse_name((void*) "field name");
+        t$SymbolKind $kind = c$SYMBOL_FLD;
+        if (($ctx->tok == c$tSTAR)) {
+            fn_next();
+            $kind = c$SYMBOL_PTR;
+        }
+        t$Type *$ftype = fn_parse_type(1);
+        t$Symbol *$sym = fn_symbol_make($fname, $ftype);
+        $sym->kind = $kind;
+        if (($ctx->tok != c$tCBRACE)) {
+            fn_require(c$tCOMMA);
+        }
+    }
+    $type->list = fn_scope_pop();
+    fn_type_finish_struct($type);
+    return $type;
+}
+#line 250 "compiler/parser.spl"
+t$Type* fn_parse_array_type(t$void) {
+    t$u32 $nelem = 0x0;
+    if (($ctx->tok == c$tCBRACK)) {
+#line 254 "compiler/parser.spl"
+        fn_next();
+    } else {
+        if (($ctx->tok != c$tNUM)) {
+            ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "array size must be numeric"); fn_error_end(); });
+        }
+        $nelem = $ctx->num;
+        fn_next();
+        fn_require(c$tCBRACK);
+    }
+    t$Type *$of = 0;
+    if (($ctx->tok == c$tSTAR)) {
+#line 266 "compiler/parser.spl"
+        fn_next();
+        $of = fn_type_make_composite(c$TYPE_POINTER, fn_parse_type(1), 0x0);
+    } else {
+        $of = fn_parse_type(0);
+    }
+#line 272 "compiler/parser.spl"
+    return fn_type_make_composite(c$TYPE_ARRAY, $of, $nelem);
+}
+#line 275 "compiler/parser.spl"
+t$Type* fn_parse_type(t$u32 $fwd_ref_ok) {
+    if (($ctx->tok == c$tSTAR)) {
+        ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "pointer types not supported"); fn_error_end(); });
+#line 280 "compiler/parser.spl"
+    } else if (($ctx->tok == c$tOBRACK)) {
+        fn_next();
+        return fn_parse_array_type();
+    } else if (($ctx->tok == c$tFN)) {
+        ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "func types not supported"); fn_error_end(); });
+#line 287 "compiler/parser.spl"
+    } else if (($ctx->tok == c$tSTRUCT)) {
+        ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "anonymous struct types not supported"); fn_error_end(); });
+#line 291 "compiler/parser.spl"
+    } else if (($ctx->tok == c$tIDN)) {
+        t$String *$name = $ctx->ident;
+        fn_next();
+        t$Type *$type = fn_type_find($name);
+        if (($type == 0)) {
+            if ($fwd_ref_ok) {
+                $type = fn_type_make($name, c$TYPE_UNDEFINED, 0, 0, 0x0);
+            } else {
+                ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "undefined type '"); fn_writes(fd,$name->text); fn_writes(fd,(void*) "' not usable here"); fn_error_end(); });
+            }
+        }
+        return $type;
+    } else {
+        fn_expected((void*) "type");
+    }
+    return 0;
+}
+#line 309 "compiler/parser.spl"
+t$Ast* fn_parse_while(t$void) {
+#line 311 "compiler/parser.spl"
+    t$Ast *$expr = fn_parse_expr();
+    fn_require(c$tOBRACE);
+    fn_scope_push(c$SCOPE_LOOP);
+    t$Ast *$block = fn_parse_block();
+    fn_scope_pop();
+    return fn_ast_make_lr(c$AST_WHILE, $expr, $block);
+}
+#line 319 "compiler/parser.spl"
+t$Ast* fn_parse_if(t$void) {
+#line 322 "compiler/parser.spl"
+    t$Ast *$expr = fn_parse_expr();
+    fn_require(c$tOBRACE);
+    fn_scope_push(c$SCOPE_BLOCK);
+    t$Ast *$block = fn_parse_block();
+    fn_scope_pop();
+#line 328 "compiler/parser.spl"
+    t$Ast *$last = fn_ast_make_lr(c$AST_CASE, $expr, $block);
+    t$Ast *$stmt = fn_ast_make_l(c$AST_IF, $last);
+#line 331 "compiler/parser.spl"
+    while (($ctx->tok == c$tELSE)) {
+#line 333 "compiler/parser.spl"
+        fn_next();
+        if (($ctx->tok == c$tIF)) {
+#line 336 "compiler/parser.spl"
+            fn_next();
+            $expr = fn_parse_expr();
+            fn_require(c$tOBRACE);
+            fn_scope_push(c$SCOPE_BLOCK);
+            $block = fn_parse_block();
+            fn_scope_pop();
+            $last->next = fn_ast_make_lr(c$AST_CASE, $expr, $block);
+            $last = $last->next;
+        } else {
+#line 346 "compiler/parser.spl"
+            fn_require(c$tOBRACE);
+            fn_scope_push(c$SCOPE_BLOCK);
+            $block = fn_parse_block();
+            fn_scope_pop();
+            $last->next = fn_ast_make_l(c$AST_ELSE, $block);
+            break;
+        }
+    }
+    return $stmt;
+}
+#line 357 "compiler/parser.spl"
+t$Ast* fn_parse_return(t$void) {
+#line 359 "compiler/parser.spl"
+    t$Ast *$node = fn_ast_make_simple(c$AST_RETURN, 0x0);
+    if (($ctx->tok == c$tSEMI)) {
+        fn_next();
+    } else {
+#line 364 "compiler/parser.spl"
+        $node->left = fn_parse_expr();
+        fn_require(c$tSEMI);
+    }
+    return $node;
+}
+#line 370 "compiler/parser.spl"
+t$Ast* fn_parse_break(t$void) {
+#line 372 "compiler/parser.spl"
+    t$Scope *$scope = fn_scope_find(c$SCOPE_LOOP);
+    if (($scope == 0)) {
+        ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "break must be used from inside a looping construct"); fn_error_end(); });
+    }
+    fn_require(c$tSEMI);
+    return fn_ast_make_simple(c$AST_BREAK, 0x0);
+}
+#line 380 "compiler/parser.spl"
+t$Ast* fn_parse_continue(t$void) {
+#line 382 "compiler/parser.spl"
+    t$Scope *$scope = fn_scope_find(c$SCOPE_LOOP);
+    if (($scope == 0)) {
+        ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "continue must be used from inside a looping construct"); fn_error_end(); });
+    }
+    fn_require(c$tSEMI);
+    return fn_ast_make_simple(c$AST_CONTINUE, 0x0);
+}
+#line 390 "compiler/parser.spl"
+t$void fn_parse_struct_init(t$Symbol *$sym) {
+    while (1) {
+        if (($ctx->tok == c$tCBRACE)) {
+            fn_next();
+            break;
+        }
+        t$String *$name = fn_parse_name((void*) "field name");
+        t$Symbol *$field = fn_type_find_field($sym->type, $name);
+        if (($field == 0)) {
+            ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "structure has no '"); fn_writes(fd,$name->text); fn_writes(fd,(void*) "' field"); fn_error_end(); });
+        }
+        fn_require(c$tCOLON);
+        if (($ctx->tok == c$tOBRACE)) {
+            fn_next();
+            fn_parse_struct_init($field);
+        } else {
+            fn_parse_expr();
+        }
+        if (($ctx->tok != c$tCBRACE)) {
+            fn_require(c$tCOMMA);
+        }
+    }
+}
+#line 414 "compiler/parser.spl"
+t$void fn_parse_array_init(t$Symbol *$sym) {
+    while (1) {
+        if (($ctx->tok == c$tCBRACE)) {
+            fn_next();
+            break;
+        }
+        fn_parse_expr();
+        if (($ctx->tok != c$tCBRACE)) {
+            fn_require(c$tCOMMA);
+        }
+    }
+}
+#line 427 "compiler/parser.spl"
+t$void fn_parse_var(t$void) {
+#line 430 "compiler/parser.spl"
+    t$String *$name = fn_parse_name((void*) "variable name");
+    t$Type *$type = fn_parse_type(0);
+    t$Symbol *$sym = fn_symbol_make($name, $type);
+#line 434 "compiler/parser.spl"
+    if (($ctx->tok == c$tASSIGN)) {
+        fn_next();
+        if (($ctx->tok == c$tOBRACE)) {
+            fn_next();
+            if (($type->kind == c$TYPE_STRUCT)) {
+                fn_parse_struct_init($sym);
+            } else if (($type->kind == c$TYPE_ARRAY)) {
+                fn_parse_array_init($sym);
+            } else {
+                ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "type "); fn_writes(fd,$type->name->text); fn_writes(fd,(void*) " cannot be initialized with {} expr"); fn_error_end(); });
+#line 445 "compiler/parser.spl"
+            }
+        } else {
+            fn_parse_expr();
+        }
+    } else {
+#line 451 "compiler/parser.spl"
+    }
+    fn_require(c$tSEMI);
+}
+#line 455 "compiler/parser.spl"
+t$Ast* fn__parse_expr_statement(t$void) {
+    t$Ast *$node = fn_parse_expr();
+    t$Ast *$expr = 0;
+    t$u32 $op = 0;
+#line 460 "compiler/parser.spl"
+    if (($ctx->tok == c$tASSIGN)) {
+#line 462 "compiler/parser.spl"
+        fn_next();
+        return fn_ast_make_lr(c$AST_ASSIGN, $node, fn_parse_expr());
+    } else if ((($ctx->tok & c$tcMASK) == c$tcAEQOP)) {
+#line 466 "compiler/parser.spl"
+        $op = (($ctx->tok - c$tADDEQ) + c$AST_ADD);
+        fn_next();
+        $expr = fn_parse_expr();
+    } else if ((($ctx->tok & c$tcMASK) == c$tcMEQOP)) {
+#line 471 "compiler/parser.spl"
+        $op = (($ctx->tok - c$tMULEQ) + c$AST_MUL);
+        fn_next();
+        $expr = fn_parse_expr();
+    } else if (($ctx->tok == c$tINC)) {
+        $op = c$AST_ADD;
+        fn_next();
+        $expr = fn_ast_make_const(0x1, $ctx->type_i32);
+    } else if (($ctx->tok == c$tDEC)) {
+        $op = c$AST_SUB;
+        $expr = fn_ast_make_const(0x1, $ctx->type_i32);
+    } else {
+#line 483 "compiler/parser.spl"
+        return $node;
+    }
+#line 487 "compiler/parser.spl"
+    $expr = fn_ast_make_lr($op, $node, $expr);
+    return fn_ast_make_lr(c$AST_ASSIGN, $node, $expr);
+}
+#line 491 "compiler/parser.spl"
+t$Ast* fn_parse_expr_statement(t$void) {
+    t$Ast *$stmt = fn_ast_make_l(c$AST_EXPR, fn__parse_expr_statement());
+    fn_require(c$tSEMI);
+    return $stmt;
+}
+#line 497 "compiler/parser.spl"
+t$Ast* fn_parse_block(t$void) {
+    t$Ast *$block = fn_ast_make_simple(c$AST_BLOCK, 0x0);
+    t$Ast *$last = 0;
+    t$Ast *$node = 0;
+    while (1) {
+        if (($ctx->tok == c$tCBRACE)) {
+            fn_next();
+            break;
+        } else if (($ctx->tok == c$tRETURN)) {
+            fn_next();
+            $node = fn_parse_return();
+        } else if (($ctx->tok == c$tBREAK)) {
+            fn_next();
+            $node = fn_parse_break();
+        } else if (($ctx->tok == c$tCONTINUE)) {
+            fn_next();
+            $node = fn_parse_continue();
+        } else if (($ctx->tok == c$tWHILE)) {
+            fn_next();
+            $node = fn_parse_while();
+        } else if (($ctx->tok == c$tIF)) {
+            fn_next();
+            $node = fn_parse_if();
+        } else if (($ctx->tok == c$tVAR)) {
+            fn_next();
+            fn_parse_var();
+        } else if (($ctx->tok == c$tSEMI)) {
+            fn_next();
+#line 526 "compiler/parser.spl"
+            continue;
+        } else {
+            $node = fn_parse_expr_statement();
+        }
+        if (($last == 0)) {
+            $block->left = $node;
+        } else {
+            $last->next = $node;
+        }
+        $last = $node;
+    }
+    return $block;
+}
+#line 540 "compiler/parser.spl"
+t$Symbol* fn_parse_param(t$String *$fname) {
+    t$String *$pname = fn_parse_name((void*) "parameter name");
+    t$Type *$ptype = fn_parse_type(0);
+    if ((fn_symbol_find($pname) != 0)) {
+        ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "duplicate parameter name '"); fn_writes(fd,$pname->text); fn_writes(fd,(void*) "'"); fn_error_end(); });
+    }
+    return fn_symbol_make($pname, $ptype);
+}
+#line 549 "compiler/parser.spl"
+t$Ast* fn_parse_fn_body(t$Symbol *$sym) {
+    $ctx->cur_fn = $sym;
+    fn_require(c$tOBRACE);
+    fn_scope_push(c$SCOPE_FUNC);
+    fn_scope_push(c$SCOPE_BLOCK);
+    t$Ast *$node = fn_parse_block();
+    fn_scope_pop();
+    fn_scope_pop();
+    $ctx->cur_fn = 0;
+    return $node;
+}
+#line 561 "compiler/parser.spl"
+t$Ast* fn_parse_fn(t$void) {
+    t$String *$fname = fn_parse_name((void*) "function name");
+    t$Type *$rtype = $ctx->type_void;
+#line 565 "compiler/parser.spl"
+    fn_scope_push(c$SCOPE_FUNC);
+#line 567 "compiler/parser.spl"
+    fn_require(c$tOPAREN);
+    t$u32 $n = 0x0;
+    if (($ctx->tok != c$tCPAREN)) {
+        fn_parse_param($fname);
+        while (($ctx->tok == c$tCOMMA)) {
+            fn_next();
+            fn_parse_param($fname);
+        }
+        $n ++;
+    }
+    fn_require(c$tCPAREN);
+#line 579 "compiler/parser.spl"
+    if (($ctx->tok != c$tOBRACE)) {
+        $rtype = fn_parse_type(0);
+    }
+#line 583 "compiler/parser.spl"
+    t$Symbol *$sym = fn_symbol_make_global($fname, $rtype);
+    $sym->kind = c$SYMBOL_FN;
+    $sym->type = fn_type_make($fname, c$TYPE_FN, $rtype, 0, $n);
+#line 587 "compiler/parser.spl"
+    t$Ast *$node = fn_ast_make_simple(c$AST_FUNC, 0x0);
+    $node->name = $fname;
+    $node->sym = $sym;
+    $node->right = fn_parse_fn_body($sym);
+#line 593 "compiler/parser.spl"
+    $sym->type->list = fn_scope_pop();
+#line 595 "compiler/parser.spl"
+    return $node;
+}
+#line 598 "compiler/parser.spl"
+t$void fn_parse_enum_def(t$void) {
+    if (($ctx->tok == c$tIDN)) {
+        t$String *$name = fn_parse_name((void*) "enum name");
+        fn_type_make($name, c$TYPE_ENUM, 0, 0, 0x0);
+    }
+#line 604 "compiler/parser.spl"
+    fn_require(c$tOBRACE);
+    t$u32 $val = 0x0;
+    while (($ctx->tok != c$tCBRACE)) {
+        t$String *$name = fn_parse_name((void*) "enum tag name");
+        t$Symbol *$sym = fn_symbol_find($name);
+        if (($sym != 0)) {
+            ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "cannot redfine '"); fn_writes(fd,$name->text); fn_writes(fd,(void*) "' as enum tag"); fn_error_end(); });
+        }
+        $sym = fn_symbol_make_global($name, $ctx->type_u32);
+        $sym->kind = c$SYMBOL_DEF;
+        if (($ctx->tok == c$tASSIGN)) {
+            fn_next();
+            fn_parse_expr();
+#line 618 "compiler/parser.spl"
+        } else {
+            $val ++;
+        }
+        fn_require(c$tCOMMA);
+    }
+    fn_require(c$tCBRACE);
+    fn_require(c$tSEMI);
+}
+#line 627 "compiler/parser.spl"
+t$void fn_parse_init(t$void) {
+    $ctx->program = fn_ast_make_simple(c$AST_PROGRAM, 0x0);
+    $ctx->last = 0;
+}
+#line 632 "compiler/parser.spl"
+t$Ast* fn_parse_program(t$void) {
+    while (1) {
+        if (($ctx->tok == c$tENUM)) {
+            fn_next();
+            fn_parse_enum_def();
+        } else if (($ctx->tok == c$tSTRUCT)) {
+            fn_next();
+            t$String *$name = fn_parse_name((void*) "struct name");
+            fn_parse_struct_type($name);
+            fn_require(c$tSEMI);
+        } else if (($ctx->tok == c$tFN)) {
+            fn_next();
+            t$Ast *$node = fn_parse_fn();
+            if (($ctx->last == 0)) {
+                $ctx->program->left = $node;
+            } else {
+                $ctx->last->next = $node;
+            }
+            $ctx->last = $node;
+        } else if (($ctx->tok == c$tVAR)) {
+            fn_next();
+            fn_parse_var();
+        } else if (($ctx->tok == c$tEOF)) {
+            break;
+        } else {
+            fn_expected((void*) "function, variable, or type definition");
+        }
+    }
+    return $ctx->program;
+}
+#line 4 "compiler/main.spl"
+t$u32 $indent = 0x0;
+#line 6 "compiler/main.spl"
+t$void fn_print_indent(t$i32 $fd) {
+    t$u32 $n = 0x0;
+    while (($n < $indent)) {
+        fn_writes($fd, (void*) "   ");
+        $n ++;
+    }
+}
+#line 14 "compiler/main.spl"
+t$void fn__dump_ast_node(t$i32 $fd, t$Ast *$node) {
+    t$AstKind $kind = $node->kind;
+#line 17 "compiler/main.spl"
+    fn_print_indent($fd);
+    fn_writes($fd, $ast_kind[$kind]);
+    fn_writes($fd, (void*) " ");
+    $indent ++;
+    if (($kind == c$AST_CONST)) {
+        fn_writex($fd, $node->ival);
+    } else if (($kind == c$AST_FUNC)) {
+        fn_writes($fd, $node->name->text);
+        fn_writes($fd, (void*) "(");
+        t$Symbol *$param = $node->sym->type->list;
+        while (($param != 0)) {
+            fn_writes($fd, $param->name->text);
+            if (($param->next != 0)) {
+                fn_writes($fd, (void*) ", ");
+            }
+            $param = $param->next;
+        }
+        fn_writes($fd, (void*) ") ");
+        fn_writes($fd, $node->sym->type->of->name->text);
+    } else if (($kind == c$AST_STRING)) {
+        fn_printstr($fd, $node->name->text);
+    } else if (($kind == c$AST_SYMBOL)) {
+        fn_writes($fd, $node->name->text);
+    }
+    fn_writes($fd, (void*) "\012");
+#line 43 "compiler/main.spl"
+    fn_dump_ast_node($fd, $node->left);
+    fn_dump_ast_node($fd, $node->right);
+    $indent = ($indent - 0x1);
+}
+#line 48 "compiler/main.spl"
+t$void fn_dump_ast_node(t$i32 $fd, t$Ast *$node) {
+    if (($node != 0)) {
+        while (1) {
+            fn__dump_ast_node($fd, $node);
+            $node = $node->next;
+            if (($node == 0)) {
+                break;
+            }
+        }
+    }
+}
+#line 60 "compiler/main.spl"
+t$void fn_dump_ast(t$Ast *$node) {
+    fn_dump_ast_node(0x1, $node);
+}
+#line 64 "compiler/main.spl"
+t$void fn_print_stats(t$void) {
+    ({ int fd = fn_fprint_begin(0x2); fn_writes(fd,(void*) "time    load  "); fn_writei(fd,$ctx->stats->t_load); fn_writes(fd,(void*) " us\012"); fn_writes(fd,(void*) "        parse "); fn_writei(fd,$ctx->stats->t_parse); fn_writes(fd,(void*) " us  (with lex and symbol resolution)\012"); fn_writes(fd,(void*) "        dump  "); fn_writei(fd,$ctx->stats->t_dump); fn_writes(fd,(void*) " us\012"); fn_fprint_end(fd); });
+#line 68 "compiler/main.spl"
+    ({ int fd = fn_fprint_begin(0x2); fn_writes(fd,(void*) "input   "); fn_writei(fd,$ctx->stats->files); fn_writes(fd,(void*) " files, "); fn_writei(fd,$ctx->stats->lines); fn_writes(fd,(void*) " lines, "); fn_writei(fd,$ctx->stats->tokens); fn_writes(fd,(void*) " tokens, "); fn_writei(fd,$ctx->stats->new_ast); fn_writes(fd,(void*) " AST nodes\012"); fn_fprint_end(fd); });
+#line 70 "compiler/main.spl"
+    ({ int fd = fn_fprint_begin(0x2); fn_writes(fd,(void*) "intern  "); fn_writei(fd,$ctx->stats->new_string); fn_writes(fd,(void*) " strings, "); fn_writei(fd,$ctx->stats->intern_lookups); fn_writes(fd,(void*) " lookups, "); fn_writei(fd,$ctx->stats->intern_hits); fn_writes(fd,(void*) " hits, "); fn_writei(fd,$ctx->stats->intern_probes); fn_writes(fd,(void*) " probes\012"); fn_fprint_end(fd); });
+#line 73 "compiler/main.spl"
+    ({ int fd = fn_fprint_begin(0x2); fn_writes(fd,(void*) "symbol  "); fn_writei(fd,$ctx->stats->symbol_lookups); fn_writes(fd,(void*) " lookups, 1 probe each\012"); fn_fprint_end(fd); });
+    ({ int fd = fn_fprint_begin(0x2); fn_writes(fd,(void*) "field   "); fn_writei(fd,$ctx->stats->field_lookups); fn_writes(fd,(void*) " lookups, "); fn_writei(fd,$ctx->stats->field_probes); fn_writes(fd,(void*) " probes\012"); fn_fprint_end(fd); });
+#line 76 "compiler/main.spl"
+    ({ int fd = fn_fprint_begin(0x2); fn_writes(fd,(void*) "alloc   String      "); fn_writei(fd,$ctx->stats->new_string); fn_writes(fd,(void*) "\012"); fn_writes(fd,(void*) "        StringPool  "); fn_writei(fd,$ctx->stats->new_pool); fn_writes(fd,(void*) "  ("); fn_writei(fd,$ctx->stats->pool_bytes); fn_writes(fd,(void*) " bytes of text)\012"); fn_writes(fd,(void*) "        Scope       "); fn_writei(fd,$ctx->stats->new_scope); fn_writes(fd,(void*) "\012"); fn_writes(fd,(void*) "        Symbol      "); fn_writei(fd,$ctx->stats->new_symbol); fn_writes(fd,(void*) "\012"); fn_writes(fd,(void*) "        Type        "); fn_writei(fd,$ctx->stats->new_type); fn_writes(fd,(void*) "\012"); fn_writes(fd,(void*) "        FieldIndex  "); fn_writei(fd,$ctx->stats->new_fieldindex); fn_writes(fd,(void*) "\012"); fn_writes(fd,(void*) "        Ast         "); fn_writei(fd,$ctx->stats->new_ast); fn_writes(fd,(void*) "\012"); fn_fprint_end(fd); });
+#line 83 "compiler/main.spl"
+}
+#line 85 "compiler/main.spl"
+t$i32 fn_start(t$void) {
+    fn_ctx_init();
+    fn_parse_init();
+    $ctx->filename = fn_os_arg(0x0);
+#line 90 "compiler/main.spl"
+    t$u32 $n = 0x1;
+    while (($n < fn_os_arg_count())) {
+        t$str $arg = fn_os_arg($n);
+        if ((($arg[0x0] == 0x2d) && ($arg[0x1] == 0x54) && ($arg[0x2] == 0x0))) {
+            $ctx->flags = ($ctx->flags | c$cfStats);
+            $n ++;
+            continue;
+        }
+        if (($arg[0x0] == 0x2d)) {
+            ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "unsupported option '"); fn_writes(fd,$arg); fn_writes(fd,(void*) "'"); fn_error_end(); });
+        }
+        t$u32 $t = fn_os_clock_us();
+        $ctx->fd_in = fn_fd_open($arg);
+        if (($ctx->fd_in == (-0x1))) {
+            ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "cannot open '"); fn_writes(fd,$arg); fn_writes(fd,(void*) "'"); fn_error_end(); });
+        }
+        $ctx->src = fn_fd_load($ctx->fd_in);
+        if (($ctx->src == 0)) {
+            ({ int fd = fn_error_begin(); fn_writes(fd,(void*) "cannot read '"); fn_writes(fd,$arg); fn_writes(fd,(void*) "'"); fn_error_end(); });
+        }
+        fn_fd_close($ctx->fd_in);
+        $ctx->fd_in = (-0x1);
+        $ctx->srcpos = 0x0;
+        $ctx->linenumber = 0x1;
+        $ctx->filename = $arg;
+        $ctx->stats->t_load = ($ctx->stats->t_load + (fn_os_clock_us() - $t));
+#line 117 "compiler/main.spl"
+        $t = fn_os_clock_us();
+        fn_scan();
+        fn_next();
+        fn_parse_program();
+        $ctx->stats->t_parse = ($ctx->stats->t_parse + (fn_os_clock_us() - $t));
+        $ctx->stats->files ++;
+        $ctx->stats->lines = ($ctx->stats->lines + $ctx->linenumber);
+#line 125 "compiler/main.spl"
+        $n ++;
+    }
+#line 128 "compiler/main.spl"
+    t$u32 $t = fn_os_clock_us();
+    fn_dump_ast($ctx->program);
+    fn_fd_flush(0x1);
+    $ctx->stats->t_dump = (fn_os_clock_us() - $t);
+#line 133 "compiler/main.spl"
+    if ((($ctx->flags & c$cfStats) != 0x0)) {
+        fn_print_stats();
+    }
+    return 0x0;
+}
+#line 1815 "out/compiler/compiler.impl.c"
+
+#include <library.impl.c>
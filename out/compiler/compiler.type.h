@@ -0,0 +1,22 @@
+typedef struct t$String t$String;
+typedef struct t$StringPool t$StringPool;
+typedef t$u8 t$u8$65536[65536];
+typedef t$u32 t$SymbolKind; // enum
+typedef struct t$Symbol t$Symbol;
+typedef t$u32 t$ScopeKind; // enum
+typedef struct t$Scope t$Scope;
+typedef t$u32 t$TypeKind; // enum
+typedef struct t$Type t$Type;
+typedef struct t$FieldIndex t$FieldIndex;
+typedef t$Symbol *t$Symbol$ptr;
+typedef t$Symbol$ptr t$Symbol$ptr$128[128];
+typedef t$u32 t$AstKind; // enum
+typedef t$str t$str$0[];
+typedef struct t$Ast t$Ast;
+typedef t$u32 t$TokenClass; // enum
+typedef t$u32 t$Token; // enum
+typedef struct t$Stats t$Stats;
+typedef struct t$Context t$Context;
+typedef t$u8 t$u8$256[256];
+typedef t$String *t$String$ptr;
+typedef t$String$ptr t$String$ptr$4096[4096];
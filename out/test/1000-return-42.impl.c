@@ -0,0 +1,12 @@
+#include <builtin.type.h>
+#include "out/test/1000-return-42.type.h"
+#include "out/test/1000-return-42.decl.h"
+
+#include <library.impl.h>
+#line 1 "test/1000-return-42.spl"
+t$i32 fn_start(t$void) {
+    return 0x2a;
+}
+#line 11 "out/test/1000-return-42.impl.c"
+
+#include <library.impl.c>
@@ -0,0 +1,2 @@
+t$i32 fn_add(t$i32 $a, t$i32 $b);
+t$i32 fn_start(t$void);
@@ -0,0 +1,16 @@
+#include <builtin.type.h>
+#include "out/test/1011-func-call-forward.type.h"
+#include "out/test/1011-func-call-forward.decl.h"
+
+#include <library.impl.h>
+#line 1 "test/1011-func-call-forward.spl"
+t$i32 fn_start(t$void) {
+    return fn_add(0x14, 0x16);
+}
+#line 5 "test/1011-func-call-forward.spl"
+t$i32 fn_add(t$i32 $a, t$i32 $b) {
+    return ($a + $b);
+}
+#line 15 "out/test/1011-func-call-forward.impl.c"
+
+#include <library.impl.c>
@@ -0,0 +1,15 @@
+#include <builtin.type.h>
+#include "out/test/1012-func-call-builtin.type.h"
+#include "out/test/1012-func-call-builtin.decl.h"
+
+#include <library.impl.h>
+#line 1 "test/1012-func-call-builtin.spl"
+t$i32 fn_start(t$void) {
+    fn__hexout_(0x10203040);
+    fn__hexout_(0xcafef00d);
+    fn__hexout_((-0x1));
+    return 0x0;
+}
+#line 14 "out/test/1012-func-call-builtin.impl.c"
+
+#include <library.impl.c>
@@ -0,0 +1,3 @@
+t$void fn_print(t$i32 $n);
+t$void fn_test(t$i32 $v2, t$i32 $v5, t$i32 $v31, t$i32 $v128000);
+t$i32 fn_start(t$void);
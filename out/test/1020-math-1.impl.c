@@ -0,0 +1,30 @@
+#include <builtin.type.h>
+#include "out/test/1020-math-1.type.h"
+#include "out/test/1020-math-1.decl.h"
+
+#include <library.impl.h>
+#line 2 "test/1020-math-1.spl"
+t$void fn_print(t$i32 $n) {
+    fn__hexout_($n);
+}
+#line 6 "test/1020-math-1.spl"
+t$void fn_test(t$i32 $v2, t$i32 $v5, t$i32 $v31, t$i32 $v128000) {
+#line 8 "test/1020-math-1.spl"
+    fn_print(0xffd23137);
+    fn_print(0x88d050a1);
+    fn_print($v2);
+    fn_print(($v128000 / 0x3e8));
+    fn_print((0x1 << $v5));
+    fn_print((~$v31));
+    fn_print(($v31 % 0x11));
+    fn_print(($v128000 * $v31));
+    fn_print((-$v128000));
+}
+#line 19 "test/1020-math-1.spl"
+t$i32 fn_start(t$void) {
+    fn_test(0x2, 0x5, 0x1f, 0x1f400);
+    return 0x0;
+}
+#line 29 "out/test/1020-math-1.impl.c"
+
+#include <library.impl.c>
@@ -0,0 +1,35 @@
+#include <builtin.type.h>
+#include "out/test/1021-numbers.type.h"
+#include "out/test/1021-numbers.decl.h"
+
+#include <library.impl.h>
+#line 2 "test/1021-numbers.spl"
+t$i32 fn_start(t$void) {
+    fn__hexout_(0xffffffff);
+    fn__hexout_(0x80000000);
+    fn__hexout_(0xffffffff);
+    fn__hexout_(0x80000000);
+    fn__hexout_(0xffffffff);
+    fn__hexout_(0x80000000);
+    fn__hexout_((-0x1));
+    fn__hexout_((-0x2));
+    fn__hexout_((-0x80000000));
+    fn__hexout_(0x7fffffff);
+    fn__hexout_(0x88aacc55);
+    fn__hexout_(0x88aacc55);
+    fn__hexout_(0x88aacc55);
+    fn__hexout_(0x61);
+    fn__hexout_(0x9);
+    fn__hexout_(0xa);
+    fn__hexout_(0xd);
+    fn__hexout_(0x5c);
+    fn__hexout_(0x27);
+    fn__hexout_(0x22);
+    fn__hexout_(0x42);
+    fn__hexout_(0xff);
+    fn__hexout_(0x80);
+    return 0x0;
+}
+#line 34 "out/test/1021-numbers.impl.c"
+
+#include <library.impl.c>
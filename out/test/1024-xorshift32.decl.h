@@ -0,0 +1,2 @@
+t$i32 fn_xorshift32(t$void);
+t$i32 fn_start(t$void);
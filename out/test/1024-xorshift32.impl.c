@@ -0,0 +1,26 @@
+#include <builtin.type.h>
+#include "out/test/1024-xorshift32.type.h"
+#include "out/test/1024-xorshift32.decl.h"
+
+#include <library.impl.h>
+#line 4 "test/1024-xorshift32.spl"
+t$i32 $state = 0xd3f56332;
+#line 6 "test/1024-xorshift32.spl"
+t$i32 fn_xorshift32(t$void) {
+    $state = ($state ^ ($state << 0xd));
+    $state = ($state ^ (($state >> 0x11) & 0x7fff));
+    $state = ($state ^ ($state << 0x5));
+    return $state;
+}
+#line 13 "test/1024-xorshift32.spl"
+t$i32 fn_start(t$void) {
+    t$i32 $n = 0x0;
+    while (($n < 0x40)) {
+        fn__hexout_(fn_xorshift32());
+        $n ++;
+    }
+    return 0x40;
+}
+#line 25 "out/test/1024-xorshift32.impl.c"
+
+#include <library.impl.c>
@@ -0,0 +1,25 @@
+#include <builtin.type.h>
+#include "out/test/1025-fibonacci.type.h"
+#include "out/test/1025-fibonacci.decl.h"
+
+#include <library.impl.h>
+#line 2 "test/1025-fibonacci.spl"
+t$i32 fn_fib(t$i32 $n) {
+    if (($n < 0x2)) {
+        return $n;
+    } else {
+        return (fn_fib(($n - 0x1)) + fn_fib(($n - 0x2)));
+    }
+}
+#line 10 "test/1025-fibonacci.spl"
+t$i32 fn_start(t$void) {
+    t$i32 $n = 0x0;
+    while (($n < 0x18)) {
+        fn__hexout_(fn_fib($n));
+        $n ++;
+    }
+    return 0x7;
+}
+#line 24 "out/test/1025-fibonacci.impl.c"
+
+#include <library.impl.c>
@@ -0,0 +1,31 @@
+#include <builtin.type.h>
+#include "out/test/1026-fib-iter.type.h"
+#include "out/test/1026-fib-iter.decl.h"
+
+#include <library.impl.h>
+#line 2 "test/1026-fib-iter.spl"
+t$i32 fn_fib(t$i32 $n) {
+    t$i32 $a = 0x0;
+    t$i32 $b = 0x1;
+    t$i32 $z = 0x0;
+    while (($n != $z)) {
+        t$i32 $t = ($a + $b);
+        $a = $b;
+        $b = $t;
+        $n = ($n - 0x1);
+        $z = 0x0;
+    }
+    return $a;
+}
+#line 16 "test/1026-fib-iter.spl"
+t$i32 fn_start(t$void) {
+    t$i32 $n = 0x0;
+    while (($n < 0x18)) {
+        fn__hexout_(fn_fib($n));
+        $n ++;
+    }
+    return 0x7;
+}
+#line 30 "out/test/1026-fib-iter.impl.c"
+
+#include <library.impl.c>
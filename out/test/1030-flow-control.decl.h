@@ -0,0 +1,4 @@
+t$void fn_hex(t$i32 $n);
+t$void fn_count(t$i32 $n);
+t$void fn_count_even(t$i32 $n);
+t$i32 fn_start(t$void);
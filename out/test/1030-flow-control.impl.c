@@ -0,0 +1,54 @@
+#include <builtin.type.h>
+#include "out/test/1030-flow-control.type.h"
+#include "out/test/1030-flow-control.decl.h"
+
+#include <library.impl.h>
+#line 1 "test/1030-flow-control.spl"
+t$void fn_hex(t$i32 $n) {
+    fn__hexout_($n);
+}
+#line 5 "test/1030-flow-control.spl"
+t$void fn_count(t$i32 $n) {
+    while (($n > 0x0)) {
+        fn_hex($n);
+        if (($n == 0x3)) {
+            break;
+        }
+        $n = ($n - 0x1);
+    }
+}
+#line 15 "test/1030-flow-control.spl"
+t$void fn_count_even(t$i32 $n) {
+    while (($n > 0x0)) {
+        $n --;
+        if ((($n & 0x1) == 0x1)) {
+            continue;
+        }
+        fn__hexout_($n);
+    }
+}
+#line 25 "test/1030-flow-control.spl"
+t$i32 fn_start(t$void) {
+    if (1) {
+        fn_hex(0x10101010);
+    } else {
+        fn_hex(0x20202020);
+    }
+#line 32 "test/1030-flow-control.spl"
+    if (0) {
+        fn_hex(0x30303030);
+    } else {
+        fn_hex(0x40404040);
+    }
+#line 38 "test/1030-flow-control.spl"
+    fn_count(0x2);
+#line 40 "test/1030-flow-control.spl"
+    fn_count(0x7);
+#line 42 "test/1030-flow-control.spl"
+    fn_count_even(0x7);
+#line 44 "test/1030-flow-control.spl"
+    return 0x1;
+}
+#line 53 "out/test/1030-flow-control.impl.c"
+
+#include <library.impl.c>
@@ -0,0 +1,7 @@
+t$i32 fn_is_three(t$i32 $n);
+t$i32 fn_is_six(t$i32 $n);
+t$i32 fn_is_nine(t$i32 $n);
+t$void fn_or_test2(t$i32 $n);
+t$void fn_or_test(t$i32 $n);
+t$void fn_and_test(t$i32 $n);
+t$i32 fn_start(t$void);
@@ -0,0 +1,63 @@
+#include <builtin.type.h>
+#include "out/test/1031-logical-and-or.type.h"
+#include "out/test/1031-logical-and-or.decl.h"
+
+#include <library.impl.h>
+#line 2 "test/1031-logical-and-or.spl"
+t$i32 fn_is_three(t$i32 $n) {
+    fn__hexout_(0x333);
+    return ($n == 0x3);
+}
+t$i32 fn_is_six(t$i32 $n) {
+    fn__hexout_(0x666);
+    return ($n == 0x6);
+}
+t$i32 fn_is_nine(t$i32 $n) {
+    fn__hexout_(0x999);
+    return ($n == 0x9);
+}
+#line 15 "test/1031-logical-and-or.spl"
+t$void fn_or_test2(t$i32 $n) {
+    if ((fn_is_three($n) || fn_is_six($n) || fn_is_nine($n))) {
+        fn__hexout_(($n | 0x1100));
+    } else {
+        fn__hexout_(($n | 0x2200));
+    }
+}
+#line 23 "test/1031-logical-and-or.spl"
+t$void fn_or_test(t$i32 $n) {
+    if ((($n == 0x3) || ($n == 0x6) || ($n == 0x9))) {
+        fn__hexout_(($n | 0x100));
+    } else {
+        fn__hexout_(($n | 0x200));
+    }
+}
+t$void fn_and_test(t$i32 $n) {
+    if (((($n & 0x1) == 0x1) && (($n & 0x2) == 0x2) && ($n < 0x8))) {
+        fn__hexout_(($n | 0x300));
+    } else {
+        fn__hexout_(($n | 0x400));
+    }
+}
+#line 38 "test/1031-logical-and-or.spl"
+t$i32 fn_start(t$void) {
+    t$i32 $n = 0x0;
+    while (($n < 0xa)) {
+        fn_or_test($n);
+        $n = ($n + 0x1);
+    }
+    $n = 0x0;
+    while (($n < 0xa)) {
+        fn_or_test2($n);
+        $n = ($n + 0x1);
+    }
+    $n = 0x0;
+    while (($n < 0x10)) {
+        fn_and_test($n);
+        $n = ($n + 0x1);
+    }
+    return 0x42;
+}
+#line 62 "out/test/1031-logical-and-or.impl.c"
+
+#include <library.impl.c>
@@ -0,0 +1,3 @@
+t$bool fn_is_odd(t$i32 $n);
+t$void fn_classify(t$i32 $n);
+t$i32 fn_start(t$void);
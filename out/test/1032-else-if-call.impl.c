@@ -0,0 +1,29 @@
+#include <builtin.type.h>
+#include "out/test/1032-else-if-call.type.h"
+#include "out/test/1032-else-if-call.decl.h"
+
+#include <library.impl.h>
+#line 2 "test/1032-else-if-call.spl"
+t$bool fn_is_odd(t$i32 $n) {
+    return (($n & 0x1) == 0x1);
+}
+#line 6 "test/1032-else-if-call.spl"
+t$void fn_classify(t$i32 $n) {
+    if (($n == 0x0)) {
+        fn__hexout_(0x100);
+    } else if (fn_is_odd($n)) {
+        fn__hexout_(0x200);
+    } else {
+        fn__hexout_(0x300);
+    }
+}
+#line 16 "test/1032-else-if-call.spl"
+t$i32 fn_start(t$void) {
+    fn_classify(0x0);
+    fn_classify(0x3);
+    fn_classify(0x4);
+    return 0x0;
+}
+#line 28 "out/test/1032-else-if-call.impl.c"
+
+#include <library.impl.c>
@@ -0,0 +1,11 @@
+struct t$Point {
+    t$i32 x;
+    t$i32 y;
+};
+struct t$Line {
+    t$Point start[1];
+    t$Point end[1];
+};
+t$void fn_add(t$Point *$a, t$Point *$b);
+t$void fn_print(t$Point *$p);
+t$i32 fn_start(t$void);
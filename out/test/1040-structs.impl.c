@@ -0,0 +1,61 @@
+#include <builtin.type.h>
+#include "out/test/1040-structs.type.h"
+#include "out/test/1040-structs.decl.h"
+
+#include <library.impl.h>
+#line 12 "test/1040-structs.spl"
+t$void fn_add(t$Point *$a, t$Point *$b) {
+    $a->x = ($a->x + $b->x);
+    $a->y = ($a->y + $b->y);
+}
+#line 17 "test/1040-structs.spl"
+t$void fn_print(t$Point *$p) {
+    fn__hexout_($p->x);
+    fn__hexout_($p->y);
+}
+#line 22 "test/1040-structs.spl"
+t$Point $$p0 = {
+#line 22 "test/1040-structs.spl"
+    0x2d,0x11,
+#line 22 "test/1040-structs.spl"
+};
+#line 22 "test/1040-structs.spl"
+t$Point *$p0 = &$$p0;
+t$Point $$p1 = {
+#line 23 "test/1040-structs.spl"
+    0x5,0x3,
+#line 23 "test/1040-structs.spl"
+};
+#line 23 "test/1040-structs.spl"
+t$Point *$p1 = &$$p1;
+#line 25 "test/1040-structs.spl"
+t$Line $$line = {
+#line 25 "test/1040-structs.spl"
+    {{0x1,0x2,}},{{0x2a,0x11,}},
+#line 25 "test/1040-structs.spl"
+};
+#line 25 "test/1040-structs.spl"
+t$Line *$line = &$$line;
+#line 32 "test/1040-structs.spl"
+t$i32 fn_start(t$void) {
+    fn__hexout_($p0->x);
+    fn__hexout_($p0->y);
+    $p0->x = 0x7b;
+    $p0->y = 0x1c8;
+    fn__hexout_($p0->x);
+    fn__hexout_($p0->y);
+    fn_add($p1, $p0);
+    fn_print($p1);
+    fn_add($p1, $p0);
+    fn_print($p1);
+    t$Point *$z = $p1;
+    $z->x = 0x10203040;
+    $z->y = 0x50607080;
+    fn_print($z);
+    fn__hexout_($z->x);
+    fn__hexout_($z->y);
+    return 0x0;
+}
+#line 60 "out/test/1040-structs.impl.c"
+
+#include <library.impl.c>
@@ -0,0 +1,2 @@
+typedef struct t$Point t$Point;
+typedef struct t$Line t$Line;
@@ -0,0 +1,2 @@
+t$void fn_dump(t$u8$8 $x);
+t$i32 fn_start(t$void);
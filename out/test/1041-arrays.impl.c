@@ -0,0 +1,41 @@
+#include <builtin.type.h>
+#include "out/test/1041-arrays.type.h"
+#include "out/test/1041-arrays.decl.h"
+
+#include <library.impl.h>
+#line 2 "test/1041-arrays.spl"
+t$u8$8 $numbers = {
+#line 2 "test/1041-arrays.spl"
+    0x1,0x2,0x4,0x8,0x10,0x20,0x40,0x80,
+#line 2 "test/1041-arrays.spl"
+};
+#line 4 "test/1041-arrays.spl"
+t$u8$8 $data = {
+#line 4 "test/1041-arrays.spl"
+    0x10,0x20,0x30,0x40,0x50,0x60,0x70,0x80,
+#line 4 "test/1041-arrays.spl"
+};
+#line 7 "test/1041-arrays.spl"
+t$void fn_dump(t$u8$8 $x) {
+    t$i32 $n = 0x0;
+    while (($n < 0x8)) {
+        fn__hexout_($x[$n]);
+        $n ++;
+    }
+}
+#line 15 "test/1041-arrays.spl"
+t$i32 fn_start(t$void) {
+    t$i32 $n = 0x0;
+    t$i32 $m = 0x0;
+    while (($n < 0x8)) {
+        fn__hexout_($numbers[$n]);
+        $m = ($m + $numbers[$n]);
+        $n ++;
+    }
+    fn__hexout_($m);
+    fn_dump($data);
+    return $n;
+}
+#line 40 "out/test/1041-arrays.impl.c"
+
+#include <library.impl.c>
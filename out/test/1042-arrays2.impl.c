@@ -0,0 +1,24 @@
+#include <builtin.type.h>
+#include "out/test/1042-arrays2.type.h"
+#include "out/test/1042-arrays2.decl.h"
+
+#include <library.impl.h>
+#line 2 "test/1042-arrays2.spl"
+t$u8$8 $data = { 0, };
+#line 4 "test/1042-arrays2.spl"
+t$i32 fn_start(t$void) {
+    t$i32 $n = 0x0;
+    while (($n < 0x8)) {
+        $data[$n] = ($n << 0x4);
+        $n ++;
+    }
+    $n = 0x0;
+    while (($n < 0x8)) {
+        fn__hexout_($data[$n]);
+        $n ++;
+    }
+    return $n;
+}
+#line 23 "out/test/1042-arrays2.impl.c"
+
+#include <library.impl.c>
@@ -0,0 +1,3 @@
+t$i32 fn_strlen(t$str $x);
+t$void fn_dump(t$str $x, t$i32 $xlen);
+t$i32 fn_start(t$void);
@@ -0,0 +1,43 @@
+#include <builtin.type.h>
+#include "out/test/1043-str.type.h"
+#include "out/test/1043-str.decl.h"
+
+#include <library.impl.h>
+#line 2 "test/1043-str.spl"
+t$str $hello = (void*) "Hello";
+#line 4 "test/1043-str.spl"
+t$i32 fn_strlen(t$str $x) {
+    t$i32 $n = 0x0;
+    while (($x[$n] != 0x0)) {
+        $n ++;
+    }
+    return $n;
+}
+#line 12 "test/1043-str.spl"
+t$void fn_dump(t$str $x, t$i32 $xlen) {
+    t$i32 $n = 0x0;
+    while (($n < $xlen)) {
+        fn__hexout_($x[$n]);
+        $n ++;
+    }
+}
+#line 20 "test/1043-str.spl"
+t$str$5 $strtab = {
+#line 20 "test/1043-str.spl"
+    (void*) "aaa",(void*) "bbb",(void*) "xxx",(void*) "ddd",(void*) "eee",
+#line 20 "test/1043-str.spl"
+};
+#line 22 "test/1043-str.spl"
+t$i32 fn_start(t$void) {
+    fn_dump($hello, fn_strlen($hello));
+    t$i32 $n = 0x0;
+    $strtab[0x2] = (void*) "ccc";
+    while (($n < 0x5)) {
+        fn_dump($strtab[$n], fn_strlen($strtab[$n]));
+        $n ++;
+    }
+    return fn_strlen($hello);
+}
+#line 42 "out/test/1043-str.impl.c"
+
+#include <library.impl.c>
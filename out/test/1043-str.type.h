@@ -0,0 +1 @@
+typedef t$str t$str$5[5];
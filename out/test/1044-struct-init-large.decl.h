@@ -0,0 +1,13 @@
+struct t$Big {
+    t$i32 a;
+    t$i32 b;
+    t$i32 c;
+    t$i32 d;
+    t$i32 e;
+    t$i32 f;
+    t$i32 g;
+    t$i32 h;
+    t$i32 i;
+    t$i32 j;
+};
+t$i32 fn_start(t$void);
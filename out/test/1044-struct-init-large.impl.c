@@ -0,0 +1,22 @@
+#include <builtin.type.h>
+#include "out/test/1044-struct-init-large.type.h"
+#include "out/test/1044-struct-init-large.decl.h"
+
+#include <library.impl.h>
+#line 8 "test/1044-struct-init-large.spl"
+t$Big $$big = {
+#line 8 "test/1044-struct-init-large.spl"
+    0x1,0x2,0x3,0x4,0x5,0x6,0x7,0x8,0x9,0xa,
+#line 8 "test/1044-struct-init-large.spl"
+};
+#line 8 "test/1044-struct-init-large.spl"
+t$Big *$big = &$$big;
+#line 10 "test/1044-struct-init-large.spl"
+t$i32 fn_start(t$void) {
+    fn__hexout_($big->a);
+    fn__hexout_($big->i);
+    return $big->j;
+}
+#line 21 "out/test/1044-struct-init-large.impl.c"
+
+#include <library.impl.c>
@@ -0,0 +1 @@
+typedef struct t$Big t$Big;
@@ -0,0 +1,7 @@
+struct t$Node {
+    t$Node *next;
+    t$i32 value;
+};
+t$void fn_print(t$Node *$node);
+t$i32 fn_start(t$void);
+#define new$0 (&(t$Node){ 0 })
@@ -0,0 +1,19 @@
+#include <builtin.type.h>
+#include "out/test/1045-list.type.h"
+#include "out/test/1045-list.decl.h"
+
+#include <library.impl.h>
+#line 7 "test/1045-list.spl"
+t$void fn_print(t$Node *$node) {
+    fn__hexout_($node->value);
+}
+#line 11 "test/1045-list.spl"
+t$i32 fn_start(t$void) {
+    t$Node *$node = new$0;
+    $node->value = 0x2a;
+    fn_print($node);
+    return 0x0;
+}
+#line 18 "out/test/1045-list.impl.c"
+
+#include <library.impl.c>
@@ -0,0 +1,5 @@
+struct t$Node {
+    t$Node *next;
+    t$i32 value;
+};
+t$i32 fn_start(t$void);
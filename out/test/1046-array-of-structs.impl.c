@@ -0,0 +1,23 @@
+#include <builtin.type.h>
+#include "out/test/1046-array-of-structs.type.h"
+#include "out/test/1046-array-of-structs.decl.h"
+
+#include <library.impl.h>
+#line 7 "test/1046-array-of-structs.spl"
+t$Node$ptr$4 $nodes = { 0, };
+#line 9 "test/1046-array-of-structs.spl"
+t$i32 fn_start(t$void) {
+    t$i32 $n = 0x0;
+    while (($n < 0x4)) {
+        $nodes[$n] = ((t$Node*) rt_new(sizeof(t$Node), 0));
+        $nodes[$n]->value = ($n * 0x3);
+        $n ++;
+    }
+    $nodes[0x2]->next = $nodes[0x3];
+    fn__hexout_($nodes[0x1]->value);
+    fn__hexout_($nodes[0x2]->next->value);
+    return $nodes[0x3]->value;
+}
+#line 22 "out/test/1046-array-of-structs.impl.c"
+
+#include <library.impl.c>
@@ -0,0 +1,3 @@
+typedef struct t$Node t$Node;
+typedef t$Node *t$Node$ptr;
+typedef t$Node$ptr t$Node$ptr$4[4];
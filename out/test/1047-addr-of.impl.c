@@ -0,0 +1,32 @@
+#include <builtin.type.h>
+#include "out/test/1047-addr-of.type.h"
+#include "out/test/1047-addr-of.decl.h"
+
+#include <library.impl.h>
+#line 2 "test/1047-addr-of.spl"
+t$u8$8 $data = {
+#line 2 "test/1047-addr-of.spl"
+    0x1,0x2,0x3,0x4,0x5,0x6,0x7,0x8,
+#line 2 "test/1047-addr-of.spl"
+};
+#line 4 "test/1047-addr-of.spl"
+t$i32 fn_sum(t$str $x, t$i32 $n) {
+    t$i32 $total = 0x0;
+    t$i32 $i = 0x0;
+    while (($i < $n)) {
+        $total = ($total + $x[$i]);
+        $i ++;
+    }
+    return $total;
+}
+#line 14 "test/1047-addr-of.spl"
+t$i32 fn_start(t$void) {
+    t$str $tail = (&$data[0x5]);
+    fn__hexout_($tail[0x0]);
+    $tail[0x1] = 0x70;
+    fn__hexout_($data[0x6]);
+    return fn_sum((&$data[0x2]), 0x3);
+}
+#line 31 "out/test/1047-addr-of.impl.c"
+
+#include <library.impl.c>
@@ -0,0 +1,13 @@
+struct t$Point {
+    t$i32 x;
+    t$i32 y;
+};
+struct t$Line {
+    t$Point start[1];
+    t$Point end[1];
+    t$Line *next;
+};
+typedef t$Point t$Point$4[4][1];
+t$void fn_move(t$Point *$p, t$i32 $dx);
+t$i32 fn_start(t$void);
+#define new$0 rt_new(sizeof(t$Line), 0)
@@ -0,0 +1,50 @@
+#include <builtin.type.h>
+#include "out/test/1048-inline-structs.type.h"
+#include "out/test/1048-inline-structs.decl.h"
+
+#include <library.impl.h>
+#line 12 "test/1048-inline-structs.spl"
+t$Point$4 $pts = { 0, };
+#line 14 "test/1048-inline-structs.spl"
+t$void fn_move(t$Point *$p, t$i32 $dx) {
+    $p->x = ($p->x + $dx);
+}
+#line 18 "test/1048-inline-structs.spl"
+t$i32 fn_start(t$void) {
+    t$Line *$line = new$0;
+    $line->start->x = 0x1;
+    $line->start->y = 0x2;
+    $line->end->x = 0x3;
+    $line->end->y = 0x4;
+    fn_move($line->start, 0x10);
+    fn__hexout_($line->start->x);
+#line 27 "test/1048-inline-structs.spl"
+    $pts[0x2][0] = *$line->end;
+    $line->end->y = 0x5;
+    fn__hexout_($pts[0x2]->y);
+    fn__hexout_($line->end->y);
+#line 32 "test/1048-inline-structs.spl"
+    t$Point $$q = {
+#line 32 "test/1048-inline-structs.spl"
+        0x7,0x8,
+#line 32 "test/1048-inline-structs.spl"
+    };
+#line 32 "test/1048-inline-structs.spl"
+    t$Point *$q = &$$q;
+    $line->start[0] = *$q;
+    $q->x = 0x9;
+    fn__hexout_($line->start->x);
+#line 37 "test/1048-inline-structs.spl"
+    t$Line $$pair = {
+#line 37 "test/1048-inline-structs.spl"
+        {{0xa,0xb,}},{{0xc,0xd,}},
+#line 37 "test/1048-inline-structs.spl"
+    };
+#line 37 "test/1048-inline-structs.spl"
+    t$Line *$pair = &$$pair;
+    fn__hexout_($pair->end->x);
+    return ($pts[0x2]->x + $pair->start->y);
+}
+#line 49 "out/test/1048-inline-structs.impl.c"
+
+#include <library.impl.c>
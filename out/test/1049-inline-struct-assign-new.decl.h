@@ -0,0 +1,10 @@
+struct t$Point {
+    t$i32 x;
+    t$i32 y;
+};
+struct t$Line {
+    t$Point start[1];
+    t$Point end[1];
+};
+t$i32 fn_start(t$void);
+#define new$0 (&(t$Line){ 0 })
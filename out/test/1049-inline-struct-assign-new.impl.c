@@ -0,0 +1,20 @@
+#include <builtin.type.h>
+#include "out/test/1049-inline-struct-assign-new.type.h"
+#include "out/test/1049-inline-struct-assign-new.decl.h"
+
+#include <library.impl.h>
+#line 12 "test/1049-inline-struct-assign-new.spl"
+t$i32 fn_start(t$void) {
+    t$Line *$line = new$0;
+    $line->start->x = 0x1;
+    $line->end->y = 0x2;
+#line 17 "test/1049-inline-struct-assign-new.spl"
+    $line->start[0] = *((t$Point*) rt_new(sizeof(t$Point), 0));
+    $line->end[0] = *((t$Point*) rt_new(sizeof(t$Point), 0x0));
+    fn__hexout_($line->start->x);
+    fn__hexout_($line->end->y);
+    return 0x0;
+}
+#line 19 "out/test/1049-inline-struct-assign-new.impl.c"
+
+#include <library.impl.c>
@@ -0,0 +1,41 @@
+#include <builtin.type.h>
+#include "out/test/1050-enums.type.h"
+#include "out/test/1050-enums.decl.h"
+
+#include <library.impl.h>
+#line 2 "test/1050-enums.spl"
+t$i32 $i = 0x3;
+#line 4 "test/1050-enums.spl"
+#define c$ZERO 0x0
+#line 4 "test/1050-enums.spl"
+#define c$ONE 0x1
+#line 4 "test/1050-enums.spl"
+#define c$TWO 0x2
+#line 6 "test/1050-enums.spl"
+#define c$A 0x5
+#line 6 "test/1050-enums.spl"
+#define c$B 0x6
+#line 6 "test/1050-enums.spl"
+#define c$C 0x10000000
+#line 6 "test/1050-enums.spl"
+#define c$D 0x10000001
+#line 6 "test/1050-enums.spl"
+#define c$E (0x32 + 0x32)
+#line 6 "test/1050-enums.spl"
+#define c$F (c$ONE * c$TWO)
+#line 8 "test/1050-enums.spl"
+t$i32 fn_start(t$void) {
+    fn__hexout_(c$ZERO);
+    fn__hexout_(c$ONE);
+    fn__hexout_(c$TWO);
+    fn__hexout_(c$A);
+    fn__hexout_(c$B);
+    fn__hexout_(c$C);
+    fn__hexout_(c$D);
+    fn__hexout_(c$E);
+    fn__hexout_(c$F);
+    return 0x0;
+}
+#line 40 "out/test/1050-enums.impl.c"
+
+#include <library.impl.c>
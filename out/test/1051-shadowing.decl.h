@@ -0,0 +1,2 @@
+t$i32 fn_bump(t$i32 $n);
+t$i32 fn_start(t$void);
@@ -0,0 +1,35 @@
+#include <builtin.type.h>
+#include "out/test/1051-shadowing.type.h"
+#include "out/test/1051-shadowing.decl.h"
+
+#include <library.impl.h>
+#line 2 "test/1051-shadowing.spl"
+#define c$RED 0x7
+#line 2 "test/1051-shadowing.spl"
+#define c$BLUE 0x9
+#line 7 "test/1051-shadowing.spl"
+t$i32 $count = 0x64;
+#line 9 "test/1051-shadowing.spl"
+t$i32 fn_bump(t$i32 $n) {
+    t$i32 $count = $n;
+    return ($count + 0x1);
+}
+#line 14 "test/1051-shadowing.spl"
+t$i32 fn_start(t$void) {
+    fn__hexout_(c$RED);
+    if (1) {
+        t$i32 $RED = 0x3;
+        fn__hexout_($RED);
+        if (1) {
+            t$i32 $BLUE = ($RED + 0x1);
+            fn__hexout_($BLUE);
+        }
+        fn__hexout_(c$BLUE);
+    }
+    fn__hexout_(c$RED);
+    fn__hexout_(fn_bump(0x5));
+    return $count;
+}
+#line 34 "out/test/1051-shadowing.impl.c"
+
+#include <library.impl.c>
@@ -0,0 +1,8 @@
+struct t$Node {
+    t$Node *next;
+    t$i32 value;
+};
+t$Node* fn_build(t$i32 $count, t$i32 $region);
+t$i32 fn_sum(t$Node *$list);
+t$i32 fn_start(t$void);
+#define new$0 (&(t$Node){ 0 })
@@ -0,0 +1,48 @@
+#include <builtin.type.h>
+#include "out/test/1052-regions.type.h"
+#include "out/test/1052-regions.decl.h"
+
+#include <library.impl.h>
+#line 7 "test/1052-regions.spl"
+t$Node* fn_build(t$i32 $count, t$i32 $region) {
+    t$Node *$list = 0;
+    t$i32 $n = 0x0;
+    while (($n < $count)) {
+        t$Node *$node = ((t$Node*) rt_new(sizeof(t$Node), $region));
+        $node->value = $n;
+        $node->next = $list;
+        $list = $node;
+        $n ++;
+    }
+    return $list;
+}
+#line 20 "test/1052-regions.spl"
+t$i32 fn_sum(t$Node *$list) {
+    t$i32 $total = 0x0;
+    while (($list != 0)) {
+        $total = ($total + $list->value);
+        $list = $list->next;
+    }
+    return $total;
+}
+#line 29 "test/1052-regions.spl"
+t$i32 fn_start(t$void) {
+    t$Node *$keep = new$0;
+    $keep->value = 0x2a;
+#line 33 "test/1052-regions.spl"
+    t$i32 $region = fn_region_create();
+    t$i32 $pass = 0x0;
+    while (($pass < 0x3)) {
+        t$Node *$list = fn_build(0x2710, $region);
+        fn__hexout_(fn_sum($list));
+        fn_region_release($region);
+        $pass ++;
+    }
+#line 42 "test/1052-regions.spl"
+    t$Node *$fresh = ((t$Node*) rt_new(sizeof(t$Node), $region));
+    fn__hexout_($fresh->value);
+    return $keep->value;
+}
+#line 47 "out/test/1052-regions.impl.c"
+
+#include <library.impl.c>
@@ -0,0 +1 @@
+typedef struct t$Node t$Node;
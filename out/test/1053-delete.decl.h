@@ -0,0 +1,14 @@
+struct t$Node {
+    t$Node *next;
+    t$i32 value;
+};
+struct t$Pair {
+    t$i32 a;
+    t$i32 b;
+    t$i32 c;
+};
+t$i32 fn_start(t$void);
+#define new$0 rt_new(sizeof(t$Node), 0)
+#define new$1 rt_new(sizeof(t$Pair), 0)
+#define new$2 (&(t$Node){ 0 })
+#define new$3 rt_new(sizeof(t$Node), 0)
@@ -0,0 +1,35 @@
+#include <builtin.type.h>
+#include "out/test/1053-delete.type.h"
+#include "out/test/1053-delete.decl.h"
+
+#include <library.impl.h>
+#line 13 "test/1053-delete.spl"
+t$i32 fn_start(t$void) {
+    t$Node *$a = new$0;
+    $a->value = 0x7;
+    t$Pair *$p = new$1;
+    $p->c = 0x3;
+    ({ __auto_type d$ = $a; rt_delete(d$, sizeof(*d$)); });
+    ({ __auto_type d$ = $p; rt_delete(d$, sizeof(*d$)); });
+#line 22 "test/1053-delete.spl"
+    t$Node *$b = new$2;
+    fn__hexout_($b->value);
+    $b->value = 0x9;
+#line 26 "test/1053-delete.spl"
+    t$i32 $total = 0x0;
+    t$i32 $n = 0x0;
+    while (($n < 0x186a0)) {
+        t$Node *$t = new$3;
+        $t->value = ($n & 0x7);
+        $total = ($total + $t->value);
+        ({ __auto_type d$ = $t; rt_delete(d$, sizeof(*d$)); });
+        $n ++;
+    }
+    fn__hexout_($total);
+    t$Node *$none = 0;
+    ({ __auto_type d$ = $none; rt_delete(d$, sizeof(*d$)); });
+    return $b->value;
+}
+#line 34 "out/test/1053-delete.impl.c"
+
+#include <library.impl.c>
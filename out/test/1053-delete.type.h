@@ -0,0 +1,2 @@
+typedef struct t$Node t$Node;
+typedef struct t$Pair t$Pair;
@@ -0,0 +1,18 @@
+struct t$Node {
+    t$Node *next;
+    t$i32 value;
+};
+t$i32 fn_total(t$Node *$p, t$Node *$q);
+t$void fn_keep(t$Node *$p);
+t$void fn_push(t$i32 $value);
+#define new$0 rt_new(sizeof(t$Node), 0)
+t$void fn_push_keep(t$i32 $value);
+#define new$1 rt_new(sizeof(t$Node), 0)
+t$void fn_push_later(t$i32 $value);
+#define new$2 rt_new(sizeof(t$Node), 0)
+t$void fn_stash(t$Node *$p);
+t$i32 fn_temp(t$i32 $value);
+#define new$3 (&(t$Node){ 0 })
+#define new$4 (&(t$Node){ 0 })
+t$i32 fn_scribble(t$void);
+t$i32 fn_start(t$void);
@@ -0,0 +1,78 @@
+#include <builtin.type.h>
+#include "out/test/1054-escape.type.h"
+#include "out/test/1054-escape.decl.h"
+
+#include <library.impl.h>
+#line 7 "test/1054-escape.spl"
+t$Node *$head = 0;
+#line 10 "test/1054-escape.spl"
+t$i32 fn_total(t$Node *$p, t$Node *$q) {
+    return ($p->value + $q->value);
+}
+#line 15 "test/1054-escape.spl"
+t$void fn_keep(t$Node *$p) {
+    $p->next = $head;
+    $head = $p;
+}
+#line 20 "test/1054-escape.spl"
+t$void fn_push(t$i32 $value) {
+    t$Node *$node = new$0;
+    $node->value = $value;
+    $node->next = $head;
+    $head = $node;
+}
+#line 27 "test/1054-escape.spl"
+t$void fn_push_keep(t$i32 $value) {
+    t$Node *$node = new$1;
+    $node->value = $value;
+    fn_keep($node);
+}
+#line 33 "test/1054-escape.spl"
+t$void fn_push_later(t$i32 $value) {
+    t$Node *$node = new$2;
+    $node->value = $value;
+    fn_stash($node);
+}
+#line 39 "test/1054-escape.spl"
+t$void fn_stash(t$Node *$p) {
+    fn_keep($p);
+}
+#line 43 "test/1054-escape.spl"
+t$i32 fn_temp(t$i32 $value) {
+    t$Node *$a = new$3;
+    t$Node *$b = new$4;
+    $a->value = $value;
+    $b->value = ($value * 0x2);
+    if (($a != 0)) {
+        return fn_total($a, $b);
+    }
+    return 0x0;
+}
+#line 54 "test/1054-escape.spl"
+t$i32 fn_scribble(t$void) {
+    t$i32 $n = 0x0;
+    t$i32 $x = 0x0;
+    while (($n < 0x8)) {
+        $x = ($x + fn_temp($n));
+        $n ++;
+    }
+    return $x;
+}
+#line 64 "test/1054-escape.spl"
+t$i32 fn_start(t$void) {
+    fn_push(0x1);
+    fn_push_keep(0x2);
+    fn_push_later(0x3);
+    fn__hexout_(fn_scribble());
+    t$i32 $sum = 0x0;
+    t$Node *$node = $head;
+    while (($node != 0)) {
+        fn__hexout_($node->value);
+        $sum = ($sum + $node->value);
+        $node = $node->next;
+    }
+    return $sum;
+}
+#line 77 "out/test/1054-escape.impl.c"
+
+#include <library.impl.c>
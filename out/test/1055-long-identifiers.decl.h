@@ -0,0 +1,6 @@
+struct t$a_structure_whose_name_is_longer_than_thirty_two_characters {
+    t$i32 a_field_whose_name_is_also_longer_than_thirty_two_characters;
+};
+typedef t$a_structure_whose_name_is_longer_than_thirty_two_characters t$a_structure_whose_name_is_longer_than_thirty_two_characters$2[2][1];
+t$i32 fn_a_function_whose_name_is_longer_than_thirty_two_characters(t$i32 $x);
+t$i32 fn_start(t$void);
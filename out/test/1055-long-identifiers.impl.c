@@ -0,0 +1,26 @@
+#include <builtin.type.h>
+#include "out/test/1055-long-identifiers.type.h"
+#include "out/test/1055-long-identifiers.decl.h"
+
+#include <library.impl.h>
+#line 5 "test/1055-long-identifiers.spl"
+t$a_structure_whose_name_is_longer_than_thirty_two_characters$2 $a_global_array_whose_name_is_longer_than_thirty_two = { 0, };
+#line 7 "test/1055-long-identifiers.spl"
+t$i32 fn_a_function_whose_name_is_longer_than_thirty_two_characters(t$i32 $x) {
+    return ($x + 0x1);
+}
+#line 11 "test/1055-long-identifiers.spl"
+t$i32 fn_start(t$void) {
+    t$a_structure_whose_name_is_longer_than_thirty_two_characters $$v = {
+#line 12 "test/1055-long-identifiers.spl"
+        0x29,
+#line 12 "test/1055-long-identifiers.spl"
+    };
+#line 12 "test/1055-long-identifiers.spl"
+    t$a_structure_whose_name_is_longer_than_thirty_two_characters *$v = &$$v;
+    $a_global_array_whose_name_is_longer_than_thirty_two[0x1][0] = *$v;
+    return fn_a_function_whose_name_is_longer_than_thirty_two_characters($a_global_array_whose_name_is_longer_than_thirty_two[0x1]->a_field_whose_name_is_also_longer_than_thirty_two_characters);
+}
+#line 25 "out/test/1055-long-identifiers.impl.c"
+
+#include <library.impl.c>
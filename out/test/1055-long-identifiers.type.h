@@ -0,0 +1 @@
+typedef struct t$a_structure_whose_name_is_longer_than_thirty_two_characters t$a_structure_whose_name_is_longer_than_thirty_two_characters;
@@ -0,0 +1,2 @@
+t$i32 fn_strlen(t$str $x);
+t$i32 fn_start(t$void);
@@ -0,0 +1,27 @@
+#include <builtin.type.h>
+#include "out/test/1056-str-escape-hex.type.h"
+#include "out/test/1056-str-escape-hex.decl.h"
+
+#include <library.impl.h>
+#line 3 "test/1056-str-escape-hex.spl"
+t$str $s = (void*) "\011f\0421\134a";
+#line 5 "test/1056-str-escape-hex.spl"
+t$i32 fn_strlen(t$str $x) {
+    t$i32 $n = 0x0;
+    while (($x[$n] != 0x0)) {
+        $n ++;
+    }
+    return $n;
+}
+#line 13 "test/1056-str-escape-hex.spl"
+t$i32 fn_start(t$void) {
+    t$i32 $n = 0x0;
+    while (($n < fn_strlen($s))) {
+        fn__hexout_($s[$n]);
+        $n ++;
+    }
+    return fn_strlen($s);
+}
+#line 26 "out/test/1056-str-escape-hex.impl.c"
+
+#include <library.impl.c>
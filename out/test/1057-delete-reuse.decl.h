@@ -0,0 +1,11 @@
+struct t$Node {
+    t$Node *next;
+    t$i32 value;
+};
+struct t$Big {
+    t$i32$512 data;
+    t$i32 value;
+};
+t$Node* fn_alloc(t$void);
+t$i32 fn_start(t$void);
+#define new$0 rt_new(sizeof(t$Big), 0)
@@ -0,0 +1,34 @@
+#include <builtin.type.h>
+#include "out/test/1057-delete-reuse.type.h"
+#include "out/test/1057-delete-reuse.decl.h"
+
+#include <library.impl.h>
+#line 12 "test/1057-delete-reuse.spl"
+t$Node* fn_alloc(t$void) {
+    return ((t$Node*) rt_new(sizeof(t$Node), 0));
+}
+#line 16 "test/1057-delete-reuse.spl"
+t$i32 fn_start(t$void) {
+#line 18 "test/1057-delete-reuse.spl"
+    t$Node *$a = fn_alloc();
+    t$Node *$first = $a;
+    ({ __auto_type d$ = $a; rt_delete(d$, sizeof(*d$)); });
+    t$Node *$b = fn_alloc();
+    if (($b == $first)) {
+        fn__hexout_(0x1);
+    }
+#line 27 "test/1057-delete-reuse.spl"
+    t$i32 $n = 0x0;
+    while (($n < 0x3e8)) {
+        t$Big *$big = new$0;
+        fn__hexout_($big->value);
+        $big->data[0x1ff] = $n;
+        $big->value = $n;
+        ({ __auto_type d$ = $big; rt_delete(d$, sizeof(*d$)); });
+        $n = ($n + 0x1f4);
+    }
+    return 0x0;
+}
+#line 33 "out/test/1057-delete-reuse.impl.c"
+
+#include <library.impl.c>
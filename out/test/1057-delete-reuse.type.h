@@ -0,0 +1,3 @@
+typedef struct t$Node t$Node;
+typedef struct t$Big t$Big;
+typedef t$i32 t$i32$512[512];
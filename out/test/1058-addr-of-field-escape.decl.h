@@ -0,0 +1,7 @@
+struct t$Buf {
+    t$u8$16 data;
+};
+t$void fn_keepit(t$void);
+#define new$0 rt_new(sizeof(t$Buf), 0)
+t$i32 fn_clobber(t$void);
+t$i32 fn_start(t$void);
@@ -0,0 +1,33 @@
+#include <builtin.type.h>
+#include "out/test/1058-addr-of-field-escape.type.h"
+#include "out/test/1058-addr-of-field-escape.decl.h"
+
+#include <library.impl.h>
+#line 6 "test/1058-addr-of-field-escape.spl"
+t$str $saved = 0;
+#line 9 "test/1058-addr-of-field-escape.spl"
+t$void fn_keepit(t$void) {
+    t$Buf *$b = new$0;
+    $b->data[0x0] = 0x41;
+    $saved = (&$b->data[0x0]);
+}
+#line 16 "test/1058-addr-of-field-escape.spl"
+t$i32 fn_clobber(t$void) {
+    t$u8$64 $junk = { 0, };
+    t$i32 $n = 0x0;
+    while (($n < 0x40)) {
+        $junk[$n] = 0xef;
+        $n ++;
+    }
+    return $junk[0x3];
+}
+#line 26 "test/1058-addr-of-field-escape.spl"
+t$i32 fn_start(t$void) {
+    fn_keepit();
+    fn_clobber();
+    fn__hexout_($saved[0x0]);
+    return 0x0;
+}
+#line 32 "out/test/1058-addr-of-field-escape.impl.c"
+
+#include <library.impl.c>
@@ -0,0 +1,3 @@
+typedef struct t$Buf t$Buf;
+typedef t$u8 t$u8$16[16];
+typedef t$u8 t$u8$64[64];
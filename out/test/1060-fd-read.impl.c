@@ -0,0 +1,37 @@
+#include <builtin.type.h>
+#include "out/test/1060-fd-read.type.h"
+#include "out/test/1060-fd-read.decl.h"
+
+#include <library.impl.h>
+#line 3 "test/1060-fd-read.spl"
+t$i32 fn_start(t$void) {
+    t$i32 $fd = fn_fd_open((void*) "test/1060-fd-read.spl");
+    if (($fd < 0x0)) {
+        return 0x1;
+    }
+    fn__hexout_(fn_readc($fd));
+    fn__hexout_(fn_readc($fd));
+    fn__hexout_(fn_fd_get_pos($fd));
+#line 13 "test/1060-fd-read.spl"
+    t$u8$16 $buf = { 0, };
+    t$i32 $n = fn_fd_read($fd, $buf, 0x10);
+    fn__hexout_($n);
+    fn__hexout_($buf[0x0]);
+    fn__hexout_($buf[0x1]);
+    fn__hexout_(fn_fd_get_pos($fd));
+#line 20 "test/1060-fd-read.spl"
+    t$u32 $total = 0x12;
+    while (($n > 0x0)) {
+        $n = fn_fd_read($fd, $buf, 0x10);
+        $total = ($total + $n);
+    }
+    fn__hexout_(fn_readc($fd));
+#line 27 "test/1060-fd-read.spl"
+    fn_fd_set_pos($fd, 0x3);
+    fn__hexout_(fn_readc($fd));
+    fn_fd_close($fd);
+    return $total;
+}
+#line 36 "out/test/1060-fd-read.impl.c"
+
+#include <library.impl.c>
@@ -0,0 +1 @@
+typedef t$u8 t$u8$16[16];
@@ -0,0 +1,27 @@
+#include <builtin.type.h>
+#include "out/test/1061-fprint.type.h"
+#include "out/test/1061-fprint.decl.h"
+
+#include <library.impl.h>
+#line 1 "test/1061-fprint.spl"
+t$i32 fn_start(t$void) {
+    t$str $name = (void*) "spl";
+    t$i32 $n = (-0x2a);
+    ({ int fd = fn_fprint_begin(0x1); fn_writes(fd,(void*) "name="); fn_writes(fd,$name); fn_writes(fd,(void*) " n="); fn_writei(fd,$n); fn_writes(fd,(void*) " hex="); fn_writex(fd,0xff); fn_writes(fd,(void*) "\012"); fn_fprint_end(fd); });
+    fn_writei(0x1, 0x0);
+    fn_writec(0x1, 0x20);
+    fn_writei(0x1, 0x7fffffff);
+    fn_writec(0x1, 0x20);
+    fn_writei(0x1, ((-0x7fffffff) - 0x1));
+    fn_writec(0x1, 0x20);
+    fn_writex(0x1, 0x0);
+    fn_writec(0x1, 0x20);
+    fn_writex(0x1, 0xdeadbeef);
+    fn_writec(0x1, 0xa);
+    fn_fd_flush(0x1);
+    fn__hexout_($n);
+    return 0x1234;
+}
+#line 26 "out/test/1061-fprint.impl.c"
+
+#include <library.impl.c>
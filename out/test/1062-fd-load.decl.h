@@ -0,0 +1 @@
+t$i32 fn_start(t$void);
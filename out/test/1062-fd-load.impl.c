@@ -0,0 +1,24 @@
+#include <builtin.type.h>
+#include "out/test/1062-fd-load.type.h"
+#include "out/test/1062-fd-load.decl.h"
+
+#include <library.impl.h>
+#line 3 "test/1062-fd-load.spl"
+t$i32 fn_start(t$void) {
+    t$i32 $fd = fn_fd_open((void*) "test/1062-fd-load.spl");
+    t$str $src = fn_fd_load($fd);
+    fn_fd_close($fd);
+    if (($src == 0)) {
+        return 0x1;
+    }
+    fn__hexout_($src[0x0]);
+    fn__hexout_($src[0x3]);
+    t$u32 $n = 0x0;
+    while (($src[$n] != 0x0)) {
+        $n ++;
+    }
+    return $n;
+}
+#line 23 "out/test/1062-fd-load.impl.c"
+
+#include <library.impl.c>
@@ -0,0 +1,21 @@
+#include <builtin.type.h>
+#include "out/test/1063-clock.type.h"
+#include "out/test/1063-clock.decl.h"
+
+#include <library.impl.h>
+#line 1 "test/1063-clock.spl"
+t$i32 fn_start(t$void) {
+#line 3 "test/1063-clock.spl"
+    t$u32 $t0 = fn_os_clock_us();
+    while ((fn_os_clock_us() == $t0)) {
+    }
+    fn__hexout_(0x1);
+    t$u32 $c0 = fn_os_kcycles();
+    while ((fn_os_kcycles() == $c0)) {
+    }
+    fn__hexout_(0x2);
+    return 0x0;
+}
+#line 20 "out/test/1063-clock.impl.c"
+
+#include <library.impl.c>
@@ -0,0 +1,2 @@
+t$void fn_a1a1a1(t$i32$17 $aaa);
+t$void fn_bad(t$void);
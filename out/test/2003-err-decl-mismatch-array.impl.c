@@ -0,0 +1,16 @@
+#include <builtin.type.h>
+#include "out/test/2003-err-decl-mismatch-array.type.h"
+#include "out/test/2003-err-decl-mismatch-array.decl.h"
+
+#include <library.impl.h>
+#line 2 "test/2003-err-decl-mismatch-array.spl"
+t$void fn_a1a1a1(t$i32$17 $aaa) {
+}
+#line 5 "test/2003-err-decl-mismatch-array.spl"
+t$void fn_bad(t$void) {
+    t$i32$10 $z = { 0, };
+    fn_a1a1a1($z);
+}
+#line 15 "out/test/2003-err-decl-mismatch-array.impl.c"
+
+#include <library.impl.c>
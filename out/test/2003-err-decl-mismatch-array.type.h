@@ -0,0 +1,2 @@
+typedef t$i32 t$i32$17[17];
+typedef t$i32 t$i32$10[10];
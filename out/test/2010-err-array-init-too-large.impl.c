@@ -0,0 +1,14 @@
+#include <builtin.type.h>
+#include "out/test/2010-err-array-init-too-large.type.h"
+#include "out/test/2010-err-array-init-too-large.decl.h"
+
+#include <library.impl.h>
+#line 1 "test/2010-err-array-init-too-large.spl"
+t$i32$4 $magic = {
+#line 1 "test/2010-err-array-init-too-large.spl"
+    0x3,0x1,0x3,0x3,0x7,
+#line 1 "test/2010-err-array-init-too-large.spl"
+};
+#line 13 "out/test/2010-err-array-init-too-large.impl.c"
+
+#include <library.impl.c>
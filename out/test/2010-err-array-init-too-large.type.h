@@ -0,0 +1 @@
+typedef t$i32 t$i32$4[4];